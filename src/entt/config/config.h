@@ -39,6 +39,14 @@
 #    define ENTT_PACKED_PAGE 1024
 #endif
 
+#ifndef ENTT_DISPATCHER_POOL_SIZE
+#    define ENTT_DISPATCHER_POOL_SIZE 256
+#endif
+
+#ifndef ENTT_META_ANY_SBO
+#    define ENTT_META_ANY_SBO sizeof(double[2])
+#endif
+
 #ifdef ENTT_DISABLE_ASSERT
 #    undef ENTT_ASSERT
 #    define ENTT_ASSERT(condition, msg) (void(0))
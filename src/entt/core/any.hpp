@@ -22,8 +22,7 @@ enum class any_operation : std::uint8_t {
     transfer,
     assign,
     destroy,
-    compare,
-    get
+    compare
 };
 
 } // namespace internal
@@ -57,16 +56,14 @@ class basic_any {
     template<typename Type>
     static constexpr bool in_situ = Len && alignof(Type) <= Align && sizeof(Type) <= Len && std::is_nothrow_move_constructible_v<Type>;
 
+    // trivial types are copied and moved bitwise and never destroyed
+    template<typename Type>
+    static constexpr bool in_situ_trivial = in_situ<Type> && std::is_trivially_copyable_v<Type> && std::is_copy_constructible_v<Type>;
+
     template<typename Type>
     static const void *basic_vtable(const operation op, const basic_any &value, const void *other) {
         static_assert(!std::is_void_v<Type> && std::is_same_v<std::remove_cv_t<std::remove_reference_t<Type>>, Type>, "Invalid type");
-        const Type *elem = nullptr;
-
-        if constexpr(in_situ<Type>) {
-            elem = (value.mode == any_policy::owner) ? reinterpret_cast<const Type *>(&value.storage) : static_cast<const Type *>(value.instance);
-        } else {
-            elem = static_cast<const Type *>(value.instance);
-        }
+        const Type *elem = static_cast<const Type *>(value.data());
 
         switch(op) {
         case operation::copy:
@@ -109,8 +106,6 @@ class basic_any {
             } else {
                 return (elem == other) ? other : nullptr;
             }
-        case operation::get:
-            return elem;
         }
 
         return nullptr;
@@ -129,6 +124,9 @@ class basic_any {
                 mode = std::is_const_v<std::remove_reference_t<Type>> ? any_policy::cref : any_policy::ref;
                 instance = (std::addressof(args), ...);
             } else if constexpr(in_situ<plain_type>) {
+                local = true;
+                trivial = in_situ_trivial<plain_type>;
+
                 if constexpr(std::is_aggregate_v<plain_type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<plain_type>)) {
                     ::new(&storage) plain_type{std::forward<Args>(args)...};
                 } else {
@@ -151,7 +149,31 @@ class basic_any {
         : instance{other.data()},
           info{other.info},
           vtable{other.vtable},
-          mode{pol} {}
+          mode{pol},
+          local{},
+          trivial{} {}
+
+    void copy_from(const basic_any &other) {
+        if(other.trivial) {
+            storage = other.storage;
+            info = other.info;
+            vtable = other.vtable;
+            local = trivial = true;
+        } else if(other.vtable) {
+            other.vtable(operation::copy, other, this);
+        }
+    }
+
+    void move_from(basic_any &other) noexcept {
+        if(other.trivial) {
+            storage = other.storage;
+        } else if(other.local) {
+            other.vtable(operation::move, other, this);
+        } else {
+            // references and elements allocated on the heap are just pointers
+            instance = std::exchange(other.instance, nullptr);
+        }
+    }
 
 public:
     /*! @brief Size of the internal storage. */
@@ -174,7 +196,9 @@ public:
         : instance{},
           info{},
           vtable{},
-          mode{any_policy::owner} {
+          mode{any_policy::owner},
+          local{},
+          trivial{} {
         initialize<Type>(std::forward<Args>(args)...);
     }
 
@@ -193,9 +217,7 @@ public:
      */
     basic_any(const basic_any &other)
         : basic_any{} {
-        if(other.vtable) {
-            other.vtable(operation::copy, other, this);
-        }
+        copy_from(other);
     }
 
     /**
@@ -206,15 +228,17 @@ public:
         : instance{},
           info{other.info},
           vtable{other.vtable},
-          mode{other.mode} {
+          mode{other.mode},
+          local{other.local},
+          trivial{other.trivial} {
         if(other.vtable) {
-            other.vtable(operation::move, other, this);
+            move_from(other);
         }
     }
 
     /*! @brief Frees the internal storage, whatever it means. */
     ~basic_any() noexcept {
-        if(vtable && (mode == any_policy::owner)) {
+        if(vtable && (mode == any_policy::owner) && !trivial) {
             vtable(operation::destroy, *this, nullptr);
         }
     }
@@ -227,10 +251,7 @@ public:
     basic_any &operator=(const basic_any &other) {
         if(this != &other) {
             reset();
-
-            if(other.vtable) {
-                other.vtable(operation::copy, other, this);
-            }
+            copy_from(other);
         }
 
         return *this;
@@ -247,10 +268,12 @@ public:
         reset();
 
         if(other.vtable) {
-            other.vtable(operation::move, other, this);
+            move_from(other);
             info = other.info;
             vtable = other.vtable;
             mode = other.mode;
+            local = other.local;
+            trivial = other.trivial;
         }
 
         return *this;
@@ -281,7 +304,11 @@ public:
      * @return An opaque pointer the contained instance, if any.
      */
     [[nodiscard]] const void *data() const noexcept {
-        return vtable ? vtable(operation::get, *this, nullptr) : nullptr;
+        if(vtable) {
+            return local ? &storage : instance;
+        }
+
+        return nullptr;
     }
 
     /**
@@ -350,7 +377,7 @@ public:
 
     /*! @brief Destroys contained object */
     void reset() {
-        if(vtable && (mode == any_policy::owner)) {
+        if(vtable && (mode == any_policy::owner) && !trivial) {
             vtable(operation::destroy, *this, nullptr);
         }
 
@@ -359,6 +386,7 @@ public:
         info = &type_id<void>();
         vtable = nullptr;
         mode = any_policy::owner;
+        local = trivial = false;
     }
 
     /**
@@ -420,6 +448,9 @@ private:
     const type_info *info;
     vtable_type *vtable;
     any_policy mode;
+    // the element lives in the internal storage, references never do
+    bool local;
+    bool trivial;
 };
 
 /**
@@ -23,6 +23,8 @@ enum class deletion_policy : std::uint8_t {
     swap_only = 2u
 };
 
+struct opaque_span;
+
 template<typename Entity = entity, typename = std::allocator<Entity>>
 class basic_sparse_set;
 
@@ -47,12 +49,18 @@ class basic_group;
 template<typename, typename = std::allocator<void>>
 class basic_observer;
 
+template<typename>
+class basic_journal;
+
 template<typename>
 class basic_organizer;
 
 template<typename, typename...>
 class basic_handle;
 
+template<typename>
+class basic_history;
+
 template<typename>
 class basic_snapshot;
 
@@ -85,6 +93,9 @@ using registry = basic_registry<>;
 /*! @brief Alias declaration for the most common use case. */
 using observer = basic_observer<registry>;
 
+/*! @brief Alias declaration for the most common use case. */
+using journal = basic_journal<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using organizer = basic_organizer<registry>;
 
@@ -108,6 +119,9 @@ using handle_view = basic_handle<registry, Args...>;
 template<typename... Args>
 using const_handle_view = basic_handle<const registry, Args...>;
 
+/*! @brief Alias declaration for the most common use case. */
+using history = basic_history<registry>;
+
 /*! @brief Alias declaration for the most common use case. */
 using snapshot = basic_snapshot<registry>;
 
@@ -0,0 +1,168 @@
+#ifndef ENTT_ENTITY_HISTORY_HPP
+#define ENTT_ENTITY_HISTORY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Ring buffer of registry states, mainly intended for rollback.
+ *
+ * A history keeps a fixed number of frames. Recording a frame copies the
+ * state of the underlying registry in the slot assigned to the frame, thus
+ * overwriting the oldest frame once the buffer is full. Any frame still in the
+ * buffer can be restored later on.<br/>
+ * Slots reuse their memory from one frame to the next. Therefore, recording
+ * the same world over and over doesn't allocate in the long run.
+ *
+ * The entity storage is part of the state. Restoring a frame brings back the
+ * free list and the version of all identifiers, so that the entities created
+ * after a rollback are the same as the first time.
+ *
+ * @warning
+ * The underlying registry cannot have groups when a frame is restored and its
+ * pools must contain copyable elements.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_history {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a history for a given registry.
+     * @param source A valid reference to a registry.
+     * @param length Number of frames to keep.
+     */
+    basic_history(registry_type &source, const size_type length)
+        : reg{&source},
+          frames{},
+          slots{} {
+        ENTT_ASSERT(length != 0u, "Invalid length");
+        frames.resize(length, invalid);
+        slots.reserve(length);
+
+        for(size_type pos{}; pos < length; ++pos) {
+            slots.emplace_back(source.get_allocator());
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_history(const basic_history &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_history(basic_history &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_history() noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This history.
+     */
+    basic_history &operator=(const basic_history &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This history.
+     */
+    basic_history &operator=(basic_history &&) noexcept = default;
+
+    /**
+     * @brief Returns the number of frames a history can keep.
+     * @return Number of frames a history can keep.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return frames.size();
+    }
+
+    /**
+     * @brief Checks if a frame is available.
+     * @param frame A frame number.
+     * @return True if the frame can be restored, false otherwise.
+     */
+    [[nodiscard]] bool contains(const size_type frame) const noexcept {
+        return (frame != invalid) && (frames[frame % frames.size()] == frame);
+    }
+
+    /**
+     * @brief Records the current state of the registry for a given frame.
+     *
+     * The slot assigned to the frame is overwritten, no matter what frame it
+     * contained before.
+     *
+     * @param frame A frame number.
+     */
+    void record(const size_type frame) {
+        ENTT_ASSERT(frame != invalid, "Invalid frame");
+        const auto pos = frame % frames.size();
+        frames[pos] = invalid;
+        reg->clone_into(slots[pos]);
+        frames[pos] = frame;
+    }
+
+    /**
+     * @brief Restores the state of the registry for a given frame.
+     *
+     * Frames that follow the restored one are discarded, since they belong to
+     * a timeline that no longer exists.
+     *
+     * @param frame A frame number.
+     */
+    void restore(const size_type frame) {
+        ENTT_ASSERT(contains(frame), "Frame not available");
+        slots[frame % frames.size()].clone_into(*reg);
+
+        for(auto &&curr: frames) {
+            if(curr != invalid && curr > frame) {
+                curr = invalid;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns a recorded state for inspection.
+     *
+     * @warning
+     * Attempting to use a frame that isn't available results in undefined
+     * behavior.
+     *
+     * @param frame A frame number.
+     * @return The state of the registry for the given frame.
+     */
+    [[nodiscard]] const registry_type &operator[](const size_type frame) const noexcept {
+        ENTT_ASSERT(contains(frame), "Frame not available");
+        return slots[frame % frames.size()];
+    }
+
+    /*! @brief Discards all frames. */
+    void clear() noexcept {
+        for(auto &&curr: frames) {
+            curr = invalid;
+        }
+    }
+
+private:
+    static constexpr auto invalid = (std::numeric_limits<size_type>::max)();
+
+    registry_type *reg;
+    std::vector<size_type> frames;
+    std::vector<registry_type> slots;
+};
+
+} // namespace entt
+
+#endif
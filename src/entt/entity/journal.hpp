@@ -0,0 +1,371 @@
+#ifndef ENTT_ENTITY_JOURNAL_HPP
+#define ENTT_ENTITY_JOURNAL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "../config/config.h"
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "../core/utility.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Append-only log of the changes made to a registry.
+ *
+ * A journal records creation and destruction of entities as well as
+ * construction, update and destruction of the elements of the tracked pools.
+ * Records are written back to back in a contiguous buffer of bytes. Elements
+ * are copied as they are, therefore only trivially copyable types can be
+ * tracked.<br/>
+ * Destruction records carry the version that the registry assigns to the
+ * released identifier by default. Versions explicitly requested upon
+ * destruction aren't visible to the journal and are only restored when the
+ * identifier is recycled, since creation records carry the full identifier.
+ *
+ * The buffer is meant to be drained in batches, either to persist it or to
+ * send it elsewhere. Clearing a journal doesn't release its memory, so that
+ * recording doesn't allocate in the long run.
+ *
+ * A journal can replay a log on a registry, as long as all the types in the
+ * log are tracked by the journal itself.
+ *
+ * @warning
+ * Lifetime of a journal doesn't necessarily have to overcome that of the
+ * registry to which it is connected. However, the journal must be disconnected
+ * from the registry before being destroyed to avoid crashes due to dangling
+ * pointers.
+ *
+ * @tparam Registry Basic registry type.
+ */
+template<typename Registry>
+class basic_journal {
+    static_assert(!std::is_const_v<Registry>, "Non-const registry type required");
+
+public:
+    /*! @brief Basic registry type. */
+    using registry_type = Registry;
+    /*! @brief Underlying entity identifier. */
+    using entity_type = typename registry_type::entity_type;
+    /*! @brief Underlying version type. */
+    using version_type = typename registry_type::version_type;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /*! @brief Kind of change described by a record. */
+    enum class operation : std::uint8_t {
+        /*! @brief An entity was created. */
+        create,
+        /*! @brief An entity was destroyed. */
+        destroy,
+        /*! @brief An element was assigned to an entity. */
+        emplace,
+        /*! @brief An element was updated. */
+        update,
+        /*! @brief An element was removed from an entity. */
+        erase
+    };
+
+private:
+    static constexpr size_type header_size = sizeof(operation) + sizeof(id_type) + sizeof(entity_type);
+    // returned by trackers when a record is invalid or truncated
+    static constexpr size_type invalid = (std::numeric_limits<size_type>::max)();
+
+    struct tracker_type {
+        basic_journal *owner;
+        const typename registry_type::common_type *storage;
+        id_type id;
+        size_type length;
+        size_type (*apply)(registry_type &, const id_type, const operation, const entity_type, const std::byte *, const size_type);
+        void (*release)(tracker_type &, registry_type &);
+    };
+
+    using container_type = dense_map<id_type, std::unique_ptr<tracker_type>, identity>;
+
+    template<operation Op>
+    static void record(tracker_type &elem, registry_type &, const entity_type entt) {
+        if constexpr(Op == operation::emplace || Op == operation::update) {
+            elem.owner->append(Op, elem.id, entt, elem.storage->value(entt), elem.length);
+        } else if constexpr(Op == operation::destroy) {
+            const auto version = entt_traits<entity_type>::to_version(entt_traits<entity_type>::next(entt));
+            elem.owner->append(Op, elem.id, entt, &version, sizeof(version));
+        } else {
+            elem.owner->append(Op, elem.id, entt, nullptr, 0u);
+        }
+    }
+
+    template<typename Type>
+    static size_type apply(registry_type &target, const id_type id, const operation op, const entity_type entt, [[maybe_unused]] const std::byte *data, [[maybe_unused]] const size_type available) {
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            if(op == operation::create) {
+                [[maybe_unused]] const auto elem = target.create(entt);
+                ENTT_ASSERT(elem == entt, "Registry out of sync");
+                return 0u;
+            } else if(op == operation::destroy && available >= sizeof(version_type)) {
+                version_type version{};
+                std::memcpy(&version, data, sizeof(version));
+                target.destroy(entt, version);
+                return sizeof(version);
+            }
+
+            return invalid;
+        } else {
+            constexpr size_type length = (component_traits<Type>::page_size == 0u) ? 0u : sizeof(Type);
+            auto &storage = target.template storage<Type>(id);
+
+            switch(op) {
+            case operation::emplace:
+                if(available < length) {
+                    return invalid;
+                }
+
+                if constexpr(length == 0u) {
+                    storage.emplace(entt);
+                } else {
+                    alignas(Type) std::byte value[sizeof(Type)];
+                    std::memcpy(value, data, sizeof(Type));
+                    storage.emplace(entt, *std::launder(reinterpret_cast<const Type *>(value)));
+                }
+
+                return length;
+            case operation::update:
+                if(available < length) {
+                    return invalid;
+                }
+
+                storage.patch(entt, [data](auto &...elem) { ((std::memcpy(static_cast<void *>(&elem), data, sizeof(Type))), ...); });
+                return length;
+            case operation::erase:
+                storage.erase(entt);
+                return 0u;
+            default:
+                return invalid;
+            }
+        }
+    }
+
+    template<typename Type>
+    static void release(tracker_type &elem, registry_type &parent) {
+        if constexpr(std::is_same_v<Type, entity_type>) {
+            parent.template on_construct<Type>().disconnect(&elem);
+            parent.template on_destroy<Type>().disconnect(&elem);
+        } else {
+            parent.template on_construct<Type>(elem.id).disconnect(&elem);
+            parent.template on_update<Type>(elem.id).disconnect(&elem);
+            parent.template on_destroy<Type>(elem.id).disconnect(&elem);
+        }
+    }
+
+    template<typename Type>
+    tracker_type &emplace_tracker(const id_type id, const size_type length) {
+        ENTT_ASSERT(!trackers.contains(id), "Type already tracked");
+        auto elem = std::make_unique<tracker_type>(tracker_type{this, &parent->template storage<Type>(id), id, length, &apply<Type>, &release<Type>});
+        return *trackers.emplace(id, std::move(elem)).first->second;
+    }
+
+    void append(const operation op, const id_type id, const entity_type entt, const void *value, const size_type length) {
+        if(const auto required = buffer.size() + header_size + length; buffer.capacity() < required) {
+            buffer.reserve((std::max)(required, buffer.capacity() * 2u));
+        }
+
+        std::byte header[header_size];
+        std::memcpy(header, &op, sizeof(op));
+        std::memcpy(header + sizeof(op), &id, sizeof(id));
+        std::memcpy(header + sizeof(op) + sizeof(id), &entt, sizeof(entt));
+        buffer.insert(buffer.end(), header, header + header_size);
+
+        if(length != 0u) {
+            const auto *elem = static_cast<const std::byte *>(value);
+            buffer.insert(buffer.end(), elem, elem + length);
+        }
+    }
+
+public:
+    /**
+     * @brief Creates a journal and connects it to a given registry.
+     *
+     * Creation and destruction of entities are always tracked.
+     *
+     * @param reg A valid reference to a registry.
+     * @param length Number of bytes to reserve for the records.
+     */
+    explicit basic_journal(registry_type &reg, const size_type length = 0u)
+        : parent{&reg},
+          trackers{},
+          buffer{} {
+        auto &elem = emplace_tracker<entity_type>(type_hash<entity_type>::value(), 0u);
+        parent->template on_construct<entity_type>().template connect<&record<operation::create>>(elem);
+        parent->template on_destroy<entity_type>().template connect<&record<operation::destroy>>(elem);
+        buffer.reserve(length);
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_journal(const basic_journal &) = delete;
+
+    /*! @brief Default move constructor, deleted on purpose. */
+    basic_journal(basic_journal &&) = delete;
+
+    /*! @brief Default destructor. */
+    ~basic_journal() noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This journal.
+     */
+    basic_journal &operator=(const basic_journal &) = delete;
+
+    /**
+     * @brief Default move assignment operator, deleted on purpose.
+     * @return This journal.
+     */
+    basic_journal &operator=(basic_journal &&) = delete;
+
+    /**
+     * @brief Starts tracking the changes made to a given pool.
+     * @tparam Type Type of element of the pool to track.
+     * @param id Optional name used to map the storage within the registry.
+     * @return This journal.
+     */
+    template<typename Type>
+    basic_journal &track(const id_type id = type_hash<Type>::value()) {
+        static_assert(std::is_trivially_copyable_v<Type>, "Trivially copyable type required");
+        static_assert(!std::is_same_v<Type, entity_type>, "Entity storage already tracked");
+        auto &elem = emplace_tracker<Type>(id, (component_traits<Type>::page_size == 0u) ? 0u : sizeof(Type));
+        parent->template on_construct<Type>(id).template connect<&record<operation::emplace>>(elem);
+        parent->template on_update<Type>(id).template connect<&record<operation::update>>(elem);
+        parent->template on_destroy<Type>(id).template connect<&record<operation::erase>>(elem);
+        return *this;
+    }
+
+    /**
+     * @brief Checks if a pool is tracked by a journal.
+     * @param id Name used to map the storage within the registry.
+     * @return True if the pool is tracked, false otherwise.
+     */
+    [[nodiscard]] bool tracked(const id_type id) const {
+        return trackers.contains(id);
+    }
+
+    /*! @brief Disconnects a journal from the registry it keeps track of. */
+    void disconnect() {
+        for(auto &&curr: trackers) {
+            curr.second->release(*curr.second, *parent);
+        }
+
+        trackers.clear();
+    }
+
+    /**
+     * @brief Returns the number of bytes in use.
+     * @return Number of bytes in use.
+     */
+    [[nodiscard]] size_type size() const noexcept {
+        return buffer.size();
+    }
+
+    /**
+     * @brief Checks whether a journal is empty.
+     * @return True if the journal is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept {
+        return buffer.empty();
+    }
+
+    /**
+     * @brief Direct access to the records of a journal.
+     *
+     * The returned pointer is such that range `[data(), data() + size())` is
+     * always a valid range, even if the journal is empty.
+     *
+     * @return A pointer to the records of the journal.
+     */
+    [[nodiscard]] const std::byte *data() const noexcept {
+        return buffer.data();
+    }
+
+    /*! @brief Discards all records without releasing memory. */
+    void clear() noexcept {
+        buffer.clear();
+    }
+
+    /**
+     * @brief Applies a log to a registry.
+     *
+     * The registry must be in the same state as the recorded one when the log
+     * starts, otherwise the behavior is undefined. Listeners of the target
+     * registry are notified as usual.<br/>
+     * Replay stops at the first record that is truncated, refers to a type that
+     * isn't tracked or describes an invalid operation. Records applied so far
+     * aren't reverted.
+     *
+     * @warning
+     * Replaying a log on the registry to which the journal is connected
+     * results in records being appended to the journal itself.
+     *
+     * @param target A valid reference to a registry.
+     * @param log A pointer to the first byte of the log.
+     * @param length Number of bytes of the log.
+     * @return True if the whole log was applied, false otherwise.
+     */
+    bool replay(registry_type &target, const std::byte *log, const size_type length) const {
+        for(size_type pos{}; pos < length;) {
+            if((length - pos) < header_size) {
+                return false;
+            }
+
+            operation op{};
+            id_type id{};
+            entity_type entt{};
+
+            std::memcpy(&op, log + pos, sizeof(op));
+            std::memcpy(&id, log + pos + sizeof(op), sizeof(id));
+            std::memcpy(&entt, log + pos + sizeof(op) + sizeof(id), sizeof(entt));
+            pos += header_size;
+
+            const auto it = trackers.find(id);
+
+            if(it == trackers.cend()) {
+                return false;
+            }
+
+            if(const auto consumed = it->second->apply(target, id, op, entt, log + pos, length - pos); consumed != invalid) {
+                pos += consumed;
+            } else {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Applies the records of a journal to a registry.
+     * @param target A valid reference to a registry.
+     * @return True if the whole log was applied, false otherwise.
+     */
+    bool replay(registry_type &target) const {
+        ENTT_ASSERT(&target != parent, "Cannot replay on the tracked registry");
+        return replay(target, buffer.data(), buffer.size());
+    }
+
+private:
+    registry_type *parent;
+    container_type trackers;
+    std::vector<std::byte> buffer;
+};
+
+} // namespace entt
+
+#endif
@@ -1,8 +1,12 @@
 #ifndef ENTT_ENTITY_MIXIN_HPP
 #define ENTT_ENTITY_MIXIN_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/any.hpp"
 #include "../signal/sigh.hpp"
@@ -20,7 +24,12 @@ namespace entt {
  * void(basic_registry<entity_type> &, entity_type);
  * @endcode
  *
- * This applies to all signals made available.
+ * This applies to all signals made available, except for range signals.<br/>
+ * Range signals receive a range of entities instead of a single identifier:
+ *
+ * @code{.cpp}
+ * void(basic_registry<entity_type> &, iterator first, iterator last);
+ * @endcode
  *
  * @tparam Type Underlying storage type.
  * @tparam Registry Basic registry type.
@@ -33,6 +42,8 @@ class basic_sigh_mixin final: public Type {
     using basic_registry_type = basic_registry<typename underlying_type::entity_type, typename underlying_type::base_type::allocator_type>;
     using sigh_type = sigh<void(owner_type &, const typename underlying_type::entity_type), typename underlying_type::allocator_type>;
     using underlying_iterator = typename underlying_type::base_type::basic_iterator;
+    using range_sigh_type = sigh<void(owner_type &, underlying_iterator, underlying_iterator), typename underlying_type::allocator_type>;
+    using range_container_type = std::vector<typename underlying_type::entity_type, typename underlying_type::base_type::allocator_type>;
 
     static_assert(std::is_base_of_v<basic_registry_type, owner_type>, "Invalid registry type");
 
@@ -42,8 +53,28 @@ class basic_sigh_mixin final: public Type {
     }
 
 private:
+    void publish_construction(owner_type &reg, const typename underlying_type::entity_type entt) {
+        if(range_construction.empty()) {
+            construction.publish(reg, entt);
+        } else {
+            const auto it = underlying_type::base_type::find(entt);
+            construction.publish(reg, entt);
+            range_construction.publish(reg, it, it + 1u);
+        }
+    }
+
+    // entities are popped at once, so that range listeners are notified only once
+    void pop_range(range_container_type &range) {
+        // iterators walk packed arrays backwards
+        std::reverse(range.begin(), range.end());
+        pop(underlying_iterator{range, static_cast<typename underlying_iterator::difference_type>(range.size())}, underlying_iterator{range, {}});
+    }
+
     void pop(underlying_iterator first, underlying_iterator last) final {
-        if(auto &reg = owner_or_assert(); destruction.empty()) {
+        auto &reg = owner_or_assert();
+        range_destruction.publish(reg, first, last);
+
+        if(destruction.empty()) {
             underlying_type::pop(first, last);
         } else {
             for(; first != last; ++first) {
@@ -56,7 +87,16 @@ private:
     }
 
     void pop_all() final {
-        if(auto &reg = owner_or_assert(); !destruction.empty()) {
+        auto &reg = owner_or_assert();
+
+        if constexpr(std::is_same_v<typename underlying_type::element_type, typename underlying_type::entity_type>) {
+            const auto last = underlying_type::base_type::end();
+            range_destruction.publish(reg, last - static_cast<typename underlying_iterator::difference_type>(underlying_type::free_list()), last);
+        } else {
+            range_destruction.publish(reg, underlying_type::base_type::begin(), underlying_type::base_type::end());
+        }
+
+        if(!destruction.empty()) {
             if constexpr(std::is_same_v<typename underlying_type::element_type, typename underlying_type::entity_type>) {
                 for(typename underlying_type::size_type pos{}, last = underlying_type::free_list(); pos < last; ++pos) {
                     destruction.publish(reg, underlying_type::base_type::operator[](pos));
@@ -82,6 +122,7 @@ private:
 
         if(auto &reg = owner_or_assert(); it != underlying_type::base_type::end()) {
             construction.publish(reg, *it);
+            range_construction.publish(reg, it, it + 1u);
         }
 
         return it;
@@ -108,7 +149,9 @@ public:
           owner{},
           construction{allocator},
           destruction{allocator},
-          update{allocator} {}
+          update{allocator},
+          range_construction{allocator},
+          range_destruction{allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_sigh_mixin(const basic_sigh_mixin &) = delete;
@@ -122,7 +165,9 @@ public:
           owner{other.owner},
           construction{std::move(other.construction)},
           destruction{std::move(other.destruction)},
-          update{std::move(other.update)} {}
+          update{std::move(other.update)},
+          range_construction{std::move(other.range_construction)},
+          range_destruction{std::move(other.range_destruction)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -134,7 +179,9 @@ public:
           owner{other.owner},
           construction{std::move(other.construction), allocator},
           destruction{std::move(other.destruction), allocator},
-          update{std::move(other.update), allocator} {}
+          update{std::move(other.update), allocator},
+          range_construction{std::move(other.range_construction), allocator},
+          range_destruction{std::move(other.range_destruction), allocator} {}
 
     /*! @brief Default destructor. */
     ~basic_sigh_mixin() noexcept override = default;
@@ -155,6 +202,8 @@ public:
         construction = std::move(other.construction);
         destruction = std::move(other.destruction);
         update = std::move(other.update);
+        range_construction = std::move(other.range_construction);
+        range_destruction = std::move(other.range_destruction);
         underlying_type::operator=(std::move(other));
         return *this;
     }
@@ -169,6 +218,8 @@ public:
         swap(construction, other.construction);
         swap(destruction, other.destruction);
         swap(update, other.update);
+        swap(range_construction, other.range_construction);
+        swap(range_destruction, other.range_destruction);
         underlying_type::swap(other);
     }
 
@@ -217,6 +268,44 @@ public:
         return sink{destruction};
     }
 
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are created and assigned to entities.<br/>
+     * Listeners are invoked once per operation with the range of entities
+     * involved, after the objects have been assigned and after the listeners
+     * of the per-entity signal.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_construct_range() noexcept {
+        return sink{range_construction};
+    }
+
+    /**
+     * @brief Returns a sink object.
+     *
+     * The sink returned by this function can be used to receive notifications
+     * whenever instances are removed from entities and thus destroyed.<br/>
+     * Listeners are invoked once per operation with the range of entities
+     * involved, before the objects have been removed and before the listeners
+     * of the per-entity signal.
+     *
+     * @warning
+     * When a storage is cleared, the range may contain tombstones if the
+     * storage uses in-place deletion.
+     *
+     * @sa sink
+     *
+     * @return A temporary sink object.
+     */
+    [[nodiscard]] auto on_destroy_range() noexcept {
+        return sink{range_destruction};
+    }
+
     /**
      * @brief Emplace elements into a storage.
      *
@@ -228,7 +317,7 @@ public:
      */
     auto emplace() {
         const auto entt = underlying_type::emplace();
-        construction.publish(owner_or_assert(), entt);
+        publish_construction(owner_or_assert(), entt);
         return entt;
     }
 
@@ -248,11 +337,11 @@ public:
     decltype(auto) emplace(const entity_type hint, Args &&...args) {
         if constexpr(std::is_same_v<typename underlying_type::element_type, typename underlying_type::entity_type>) {
             const auto entt = underlying_type::emplace(hint, std::forward<Args>(args)...);
-            construction.publish(owner_or_assert(), entt);
+            publish_construction(owner_or_assert(), entt);
             return entt;
         } else {
             underlying_type::emplace(hint, std::forward<Args>(args)...);
-            construction.publish(owner_or_assert(), hint);
+            publish_construction(owner_or_assert(), hint);
             return this->get(hint);
         }
     }
@@ -286,14 +375,123 @@ public:
      */
     template<typename It, typename... Args>
     void insert(It first, It last, Args &&...args) {
-        auto from = underlying_type::size();
+        const auto from = underlying_type::size();
         underlying_type::insert(first, last, std::forward<Args>(args)...);
+        const auto to = underlying_type::size();
+        auto &reg = owner_or_assert();
 
-        if(auto &reg = owner_or_assert(); !construction.empty()) {
-            for(const auto to = underlying_type::size(); from != to; ++from) {
-                construction.publish(reg, underlying_type::operator[](from));
+        if(!construction.empty()) {
+            for(auto pos = from; pos != to; ++pos) {
+                construction.publish(reg, underlying_type::operator[](pos));
             }
         }
+
+        if(!range_construction.empty()) {
+            using difference_type = typename underlying_iterator::difference_type;
+            const auto end = underlying_type::base_type::end();
+            range_construction.publish(reg, end - static_cast<difference_type>(to), end - static_cast<difference_type>(from));
+        }
+    }
+
+    using underlying_type::erase;
+
+    /**
+     * @brief Erases entities from a storage.
+     *
+     * Range listeners, if any, are invoked only once for the whole range, no
+     * matter what type of iterator is used.
+     *
+     * @warning
+     * Attempting to erase an entity that doesn't belong to the storage results
+     * in undefined behavior.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     */
+    template<typename It>
+    void erase(It first, It last) {
+        if(std::is_same_v<It, underlying_iterator> || range_destruction.empty()) {
+            underlying_type::erase(first, last);
+        } else {
+            range_container_type range(first, last, underlying_type::base_type::get_allocator());
+            pop_range(range);
+        }
+    }
+
+    using underlying_type::remove;
+
+    /**
+     * @brief Removes entities from a storage if they exist.
+     *
+     * Range listeners, if any, are invoked only once for the whole range, no
+     * matter what type of iterator is used. Entities that appear more than
+     * once in the range are removed only once, where they first appear.
+     *
+     * @tparam It Type of input iterator.
+     * @param first An iterator to the first element of the range of entities.
+     * @param last An iterator past the last element of the range of entities.
+     * @return The number of entities actually removed.
+     */
+    template<typename It>
+    typename underlying_type::size_type remove(It first, It last) {
+        if(range_destruction.empty()) {
+            return underlying_type::remove(first, last);
+        }
+
+        if constexpr(std::is_same_v<It, underlying_iterator>) {
+            if(std::all_of(first, last, [this](const auto entt) { return this->contains(entt); })) {
+                pop(first, last);
+                return static_cast<typename underlying_type::size_type>(last - first);
+            }
+        }
+
+        range_container_type range{underlying_type::base_type::get_allocator()};
+
+        for(; first != last; ++first) {
+            if(const auto entt = *first; this->contains(entt)) {
+                range.push_back(entt);
+            }
+        }
+
+        if constexpr(!std::is_same_v<It, underlying_iterator>) {
+            if(range.size() > 1u) {
+                std::vector<std::size_t, typename std::allocator_traits<allocator_type>::template rebind_alloc<std::size_t>> order(range.size(), this->get_allocator());
+
+                for(std::size_t pos{}; pos < order.size(); ++pos) {
+                    order[pos] = pos;
+                }
+
+                std::stable_sort(order.begin(), order.end(), [this, &range](const auto lhs, const auto rhs) { return this->index(range[lhs]) < this->index(range[rhs]); });
+
+                for(std::size_t pos = 1u, prev = order[0u]; pos < order.size(); ++pos) {
+                    if(range[order[pos]] == range[prev]) {
+                        range[order[pos]] = null;
+                    } else {
+                        prev = order[pos];
+                    }
+                }
+
+                range.erase(std::remove(range.begin(), range.end(), null), range.end());
+            }
+        }
+
+        pop_range(range);
+        return range.size();
+    }
+
+    /**
+     * @brief Returns a deep copy of a storage.
+     *
+     * Listeners aren't copied and the newly created storage isn't bound to any
+     * registry.
+     *
+     * @return A newly created storage that owns a copy of the elements.
+     */
+    [[nodiscard]] std::shared_ptr<typename underlying_type::base_type> fork() const final {
+        basic_sigh_mixin elem{this->get_allocator()};
+        elem.underlying_type::copy_from(*this);
+        return std::allocate_shared<basic_sigh_mixin>(this->get_allocator(), std::move(elem));
     }
 
     /**
@@ -311,6 +509,8 @@ private:
     sigh_type construction;
     sigh_type destruction;
     sigh_type update;
+    range_sigh_type range_construction;
+    range_sigh_type range_destruction;
 };
 
 } // namespace entt
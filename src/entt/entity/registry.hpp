@@ -238,6 +238,8 @@ class basic_registry {
     // std::shared_ptr because of its type erased allocator which is useful here
     using pool_container_type = dense_map<id_type, std::shared_ptr<base_type>, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<base_type>>>>;
     using group_container_type = dense_map<id_type, std::shared_ptr<internal::group_descriptor>, identity, std::equal_to<>, typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::shared_ptr<internal::group_descriptor>>>>;
+    // default named pools mapped by type index, validated on access since indexes differ across boundaries
+    using index_container_type = std::vector<base_type *, typename alloc_traits::template rebind_alloc<base_type *>>;
     using traits_type = entt_traits<Entity>;
 
     template<typename Type>
@@ -250,6 +252,10 @@ class basic_registry {
         } else {
             using storage_type = storage_for_type<Type>;
 
+            if(const auto idx = type_index<Type>::value(); (id == type_hash<Type>::value()) && (idx < index.size()) && index[idx] && (index[idx]->type() == type_id<Type>())) {
+                return static_cast<storage_type &>(*index[idx]);
+            }
+
             if(auto it = pools.find(id); it == pools.cend()) {
                 using alloc_type = typename storage_type::allocator_type;
                 typename pool_container_type::mapped_type cpool{};
@@ -263,10 +269,12 @@ class basic_registry {
 
                 pools.emplace(id, cpool);
                 cpool->bind(forward_as_any(*this));
+                cache<Type>(id, *cpool);
 
                 return static_cast<storage_type &>(*cpool);
             } else {
                 ENTT_ASSERT(it->second->type() == type_id<Type>(), "Unexpected type");
+                cache<Type>(id, *it->second);
                 return static_cast<storage_type &>(*it->second);
             }
         }
@@ -280,6 +288,10 @@ class basic_registry {
             ENTT_ASSERT(id == type_hash<Type>::value(), "User entity storage not allowed");
             return &entities;
         } else {
+            if(const auto idx = type_index<Type>::value(); (id == type_hash<Type>::value()) && (idx < index.size()) && index[idx] && (index[idx]->type() == type_id<Type>())) {
+                return static_cast<const storage_for_type<Type> *>(index[idx]);
+            }
+
             if(const auto it = pools.find(id); it != pools.cend()) {
                 ENTT_ASSERT(it->second->type() == type_id<Type>(), "Unexpected type");
                 return static_cast<const storage_for_type<Type> *>(it->second.get());
@@ -289,6 +301,17 @@ class basic_registry {
         }
     }
 
+    template<typename Type>
+    void cache(const id_type id, base_type &elem) {
+        if(const auto idx = type_index<Type>::value(); id == type_hash<Type>::value()) {
+            if(!(idx < index.size())) {
+                index.resize(idx + 1u, nullptr);
+            }
+
+            index[idx] = &elem;
+        }
+    }
+
     void rebind() {
         entities.bind(forward_as_any(*this));
 
@@ -341,6 +364,7 @@ public:
     basic_registry(const size_type count, const allocator_type &allocator = allocator_type{})
         : vars{allocator},
           pools{allocator},
+          index{allocator},
           groups{allocator},
           entities{allocator} {
         pools.reserve(count);
@@ -357,6 +381,7 @@ public:
     basic_registry(basic_registry &&other) noexcept
         : vars{std::move(other.vars)},
           pools{std::move(other.pools)},
+          index{std::move(other.index)},
           groups{std::move(other.groups)},
           entities{std::move(other.entities)} {
         rebind();
@@ -379,6 +404,7 @@ public:
     basic_registry &operator=(basic_registry &&other) noexcept {
         vars = std::move(other.vars);
         pools = std::move(other.pools);
+        index = std::move(other.index);
         groups = std::move(other.groups);
         entities = std::move(other.entities);
 
@@ -396,6 +422,7 @@ public:
 
         swap(vars, other.vars);
         swap(pools, other.pools);
+        swap(index, other.index);
         swap(groups, other.groups);
         swap(entities, other.entities);
 
@@ -411,6 +438,71 @@ public:
         return entities.get_allocator();
     }
 
+    /**
+     * @brief Returns a deep copy of a registry.
+     *
+     * Entities and elements are copied, so that the returned registry is a
+     * consistent and independent snapshot of the original one. It can be
+     * handed to another thread and inspected while this registry is updated.
+     * <br/>
+     * Listeners, groups and context variables aren't part of the copy.
+     *
+     * @warning
+     * All the pools must contain copyable elements, otherwise the copied pools
+     * are left empty.
+     *
+     * @return A newly created registry.
+     */
+    [[nodiscard]] basic_registry fork() const {
+        basic_registry other{pools.size(), get_allocator()};
+        clone_into(other);
+        return other;
+    }
+
+    /**
+     * @brief Copies entities and elements into another registry.
+     *
+     * The destination registry becomes a copy of this one. Memory already
+     * allocated by its pools is reused, so that cloning a registry over and
+     * over into the same destination doesn't allocate in the long run.<br/>
+     * Listeners and context variables of the destination are left untouched
+     * and no signal is emitted while copying elements.<br/>
+     * Pools of the destination that don't exist in this registry are cleared
+     * first, as if by a call to `clear`. Therefore, their listeners are
+     * notified of the destruction of their elements. Pools with the same name
+     * but a different type of elements are replaced by a copy of the original
+     * pool instead and their listeners are lost.
+     *
+     * @warning
+     * The destination registry cannot have groups and all the pools must
+     * contain copyable elements.
+     *
+     * @param other The registry to copy into.
+     */
+    void clone_into(basic_registry &other) const {
+        ENTT_ASSERT(this != &other, "Cannot clone a registry into itself");
+        ENTT_ASSERT(other.groups.empty(), "Cannot clone into a registry with groups");
+
+        for(auto &&curr: other.pools) {
+            if(!pools.contains(curr.first)) {
+                curr.second->clear();
+            }
+        }
+
+        entities.clone_into(other.entities);
+
+        for(auto &&curr: pools) {
+            if(const auto it = other.pools.find(curr.first); it != other.pools.end() && it->second->type() == curr.second->type()) {
+                curr.second->clone_into(*it->second);
+            } else if(it != other.pools.end()) {
+                it->second = curr.second->fork();
+                it->second->bind(forward_as_any(other));
+            } else {
+                other.pools.emplace(curr.first, curr.second->fork()).first->second->bind(forward_as_any(other));
+            }
+        }
+    }
+
     /**
      * @brief Returns an iterable object to use to _visit_ a registry.
      *
@@ -1213,6 +1305,7 @@ public:
 private:
     context vars;
     pool_container_type pools;
+    index_container_type index;
     group_container_type groups;
     storage_for_type<entity_type> entities;
 };
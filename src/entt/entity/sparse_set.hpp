@@ -1,6 +1,7 @@
 #ifndef ENTT_ENTITY_SPARSE_SET_HPP
 #define ENTT_ENTITY_SPARSE_SET_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <memory>
@@ -135,6 +136,16 @@ template<typename Container>
 } // namespace internal
 /*! @endcond */
 
+/*! @brief Contiguous range of opaque elements. */
+struct opaque_span {
+    /*! @brief Pointer to the first element, if any. */
+    const void *base;
+    /*! @brief Distance in bytes between two consecutive elements. */
+    std::size_t stride;
+    /*! @brief Number of elements in the range. */
+    std::size_t count;
+};
+
 /**
  * @brief Sparse set implementation.
  *
@@ -229,6 +240,10 @@ private:
         return nullptr;
     }
 
+    [[nodiscard]] virtual opaque_span span_at(const std::size_t pos) const {
+        return {nullptr, 0u, packed.size() - pos};
+    }
+
     virtual void swap_or_move([[maybe_unused]] const std::size_t lhs, [[maybe_unused]] const std::size_t rhs) {
         ENTT_ASSERT((mode != deletion_policy::swap_only) || ((lhs < head) == (rhs < head)), "Cross swapping is not supported");
     }
@@ -276,6 +291,45 @@ protected:
     }
 
 protected:
+    /**
+     * @brief Copies entities and free list from another sparse set.
+     *
+     * Sparse pages already allocated are reused, missing ones are created
+     * before any change is made to the sparse set.
+     *
+     * @param other The sparse set to copy from.
+     */
+    void copy_from(const basic_sparse_set &other) {
+        ENTT_ASSERT((*info == *other.info) && (mode == other.mode), "Invalid sparse set");
+        constexpr entity_type init = null;
+        auto page_allocator{packed.get_allocator()};
+        packed.reserve(other.packed.size());
+
+        if(sparse.size() < other.sparse.size()) {
+            sparse.resize(other.sparse.size(), nullptr);
+        }
+
+        for(size_type pos{}, last = other.sparse.size(); pos < last; ++pos) {
+            if(other.sparse[pos] && !sparse[pos]) {
+                sparse[pos] = alloc_traits::allocate(page_allocator, traits_type::page_size);
+                std::uninitialized_fill(sparse[pos], sparse[pos] + traits_type::page_size, init);
+            }
+        }
+
+        for(size_type pos{}, last = sparse.size(); pos < last; ++pos) {
+            if(sparse[pos]) {
+                if(pos < other.sparse.size() && other.sparse[pos]) {
+                    std::copy(other.sparse[pos], other.sparse[pos] + traits_type::page_size, sparse[pos]);
+                } else {
+                    std::fill(sparse[pos], sparse[pos] + traits_type::page_size, init);
+                }
+            }
+        }
+
+        packed.assign(other.packed.cbegin(), other.packed.cend());
+        head = other.head;
+    }
+
     /**
      * @brief Erases entities from a sparse set.
      * @param first An iterator to the first element of the range of entities.
@@ -747,6 +801,38 @@ public:
         return const_cast<void *>(std::as_const(*this).value(entt));
     }
 
+    /**
+     * @brief Returns the contiguous range of elements that starts at a given
+     * position, if any.
+     *
+     * The range ends with the page that contains the given position or with the
+     * sparse set, whichever comes first. Therefore, all elements are visited in
+     * a few steps as in:
+     *
+     * @code{.cpp}
+     * for(auto pos = 0u; pos < set.size(); pos += set.span(pos).count) {
+     *     // ...
+     * }
+     * @endcode
+     *
+     * The element at position `pos + n` within the range belongs to the entity
+     * returned by `data()[pos + n]`. When the sparse set doesn't contain any
+     * element, the base pointer is null and the stride is zero.
+     *
+     * @warning
+     * Attempting to use a position that isn't in the range of the sparse set
+     * results in undefined behavior.<br/>
+     * Tombstones aren't skipped and their elements mustn't be accessed.
+     *
+     * @param pos The position from which the range starts.
+     * @return The contiguous range of elements that starts at the given
+     * position.
+     */
+    [[nodiscard]] opaque_span span(const size_type pos) const {
+        ENTT_ASSERT(pos < packed.size(), "Index out of bounds");
+        return span_at(pos);
+    }
+
     /**
      * @brief Assigns an entity to a sparse set.
      *
@@ -1051,6 +1137,37 @@ public:
         return *info;
     }
 
+    /**
+     * @brief Returns a deep copy of a sparse set.
+     *
+     * The copy has the same concrete type of the original object. Derived
+     * classes are in charge of copying their own data, if any.
+     *
+     * @return A newly created sparse set that owns a copy of the entities.
+     */
+    [[nodiscard]] virtual std::shared_ptr<basic_sparse_set> fork() const {
+        basic_sparse_set elem{*info, mode, get_allocator()};
+        elem.copy_from(*this);
+        return std::allocate_shared<basic_sparse_set>(get_allocator(), std::move(elem));
+    }
+
+    /**
+     * @brief Copies entities and free list into another sparse set.
+     *
+     * Memory already allocated by the destination is reused when possible.
+     * Derived classes are in charge of copying their own data, if any.
+     *
+     * @warning
+     * The destination must have the same concrete type of this object,
+     * otherwise the behavior is undefined.
+     *
+     * @param other The sparse set to copy into.
+     */
+    virtual void clone_into(basic_sparse_set &other) const {
+        ENTT_ASSERT(other.type() == type(), "Invalid sparse set");
+        other.copy_from(*this);
+    }
+
     /*! @brief Forwards variables to derived classes, if any. */
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
     virtual void bind(any) noexcept {}
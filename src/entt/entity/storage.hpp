@@ -2,6 +2,7 @@
 #define ENTT_ENTITY_STORAGE_HPP
 
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <tuple>
@@ -303,6 +304,12 @@ private:
         return std::addressof(element_at(pos));
     }
 
+    [[nodiscard]] opaque_span span_at(const std::size_t pos) const final {
+        const auto offset = fast_mod(pos, traits_type::page_size);
+        const auto count = (base_type::size() - pos) < (traits_type::page_size - offset) ? (base_type::size() - pos) : (traits_type::page_size - offset);
+        return {std::addressof(element_at(pos)), sizeof(element_type), count};
+    }
+
     void swap_or_move([[maybe_unused]] const std::size_t from, [[maybe_unused]] const std::size_t to) override {
         static constexpr bool is_pinned_type_v = !(std::is_move_constructible_v<Type> && std::is_move_assignable_v<Type>);
         // use a runtime value to avoid compile-time suppression that drives the code coverage tool crazy
@@ -326,6 +333,72 @@ private:
     }
 
 protected:
+    /**
+     * @brief Copies entities and elements from another storage.
+     *
+     * Elements already in the storage are destroyed and pages already
+     * allocated are reused. Trivially copyable types are copied one page at a
+     * time rather than element-wise.
+     *
+     * @param other The storage to copy from.
+     */
+    void copy_from(const basic_storage &other) {
+        ENTT_ASSERT(other.empty() || std::is_copy_constructible_v<element_type>, "Non-copyable type");
+        allocator_type allocator{get_allocator()};
+
+        if constexpr(!std::is_trivially_destructible_v<element_type>) {
+            const auto *data = base_type::data();
+
+            for(size_type pos{}, length = base_type::size(); pos < length; ++pos) {
+                if(!traits_type::in_place_delete || (data[pos] != tombstone)) {
+                    alloc_traits::destroy(allocator, std::addressof(element_at(pos)));
+                }
+            }
+        }
+
+        [[maybe_unused]] const auto *data = other.base_type::data();
+        size_type pos{};
+
+        ENTT_TRY {
+            if constexpr(std::is_copy_constructible_v<element_type>) {
+                if(const auto length = other.base_type::size(); length != 0u) {
+                    assure_at_least(length - 1u);
+
+                    if constexpr(std::is_trivially_copyable_v<element_type>) {
+                        for(size_type page{}; pos < length; ++page, pos += traits_type::page_size) {
+                            const auto count = (length - pos) < traits_type::page_size ? (length - pos) : traits_type::page_size;
+                            std::memcpy(static_cast<void *>(to_address(payload[page])), to_address(other.payload[page]), count * sizeof(element_type));
+                        }
+
+                        pos = length;
+                    } else {
+                        for(; pos < length; ++pos) {
+                            if(!traits_type::in_place_delete || (data[pos] != tombstone)) {
+                                entt::uninitialized_construct_using_allocator(std::addressof(element_at(pos)), allocator, other.element_at(pos));
+                            }
+                        }
+                    }
+                }
+
+                base_type::copy_from(other);
+            } else {
+                base_type::pop_all();
+            }
+        }
+        ENTT_CATCH {
+            if constexpr(!std::is_trivially_destructible_v<element_type>) {
+                for(; pos; --pos) {
+                    if(!traits_type::in_place_delete || (data[pos - 1u] != tombstone)) {
+                        alloc_traits::destroy(allocator, std::addressof(element_at(pos - 1u)));
+                    }
+                }
+            }
+
+            base_type::pop_all();
+            ENTT_THROW;
+        }
+    }
+
     /**
      * @brief Erases entities from a storage.
      * @param first An iterator to the first element of the range of entities.
@@ -775,6 +848,29 @@ public:
         return const_reverse_iterable{{base_type::crbegin(), crbegin()}, {base_type::crend(), crend()}};
     }
 
+    /**
+     * @brief Returns a deep copy of a storage.
+     * @return A newly created storage that owns a copy of the elements.
+     */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        basic_storage elem{get_allocator()};
+        elem.copy_from(*this);
+        return std::allocate_shared<basic_storage>(get_allocator(), std::move(elem));
+    }
+
+    /**
+     * @brief Copies entities and elements into another storage.
+     *
+     * Pages already allocated by the destination are reused, so that copying
+     * into the same storage over and over doesn't allocate in the long run.
+     *
+     * @param other The storage to copy into.
+     */
+    void clone_into(base_type &other) const override {
+        ENTT_ASSERT(other.type() == base_type::type(), "Invalid storage");
+        static_cast<basic_storage &>(other).copy_from(*this);
+    }
+
 private:
     container_type payload;
 };
@@ -963,6 +1059,16 @@ public:
     [[nodiscard]] const_reverse_iterable reach() const noexcept {
         return const_reverse_iterable{{base_type::crbegin()}, {base_type::crend()}};
     }
+
+    /**
+     * @brief Returns a deep copy of a storage.
+     * @return A newly created storage that owns a copy of the entities.
+     */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        basic_storage elem{get_allocator()};
+        elem.copy_from(*this);
+        return std::allocate_shared<basic_storage>(get_allocator(), std::move(elem));
+    }
 };
 
 /**
@@ -990,6 +1096,15 @@ class basic_storage<Entity, Entity, Allocator>
     }
 
 protected:
+    /**
+     * @brief Copies identifiers and free list from another storage.
+     * @param other The storage to copy from.
+     */
+    void copy_from(const basic_storage &other) {
+        base_type::copy_from(other);
+        placeholder = other.placeholder;
+    }
+
     /*! @brief Erases all entities of a storage. */
     void pop_all() override {
         base_type::pop_all();
@@ -1196,6 +1311,25 @@ public:
         return const_reverse_iterable{it, it + base_type::free_list()};
     }
 
+    /**
+     * @brief Returns a deep copy of a storage.
+     * @return A newly created storage that owns a copy of the identifiers.
+     */
+    [[nodiscard]] std::shared_ptr<base_type> fork() const override {
+        basic_storage elem{base_type::get_allocator()};
+        elem.copy_from(*this);
+        return std::allocate_shared<basic_storage>(base_type::get_allocator(), std::move(elem));
+    }
+
+    /**
+     * @brief Copies identifiers and free list into another storage.
+     * @param other The storage to copy into.
+     */
+    void clone_into(base_type &other) const override {
+        ENTT_ASSERT(other.type() == base_type::type(), "Invalid storage");
+        static_cast<basic_storage &>(other).copy_from(*this);
+    }
+
 private:
     size_type placeholder{};
 };
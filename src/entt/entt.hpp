@@ -27,6 +27,8 @@
 #include "entity/group.hpp"
 #include "entity/handle.hpp"
 #include "entity/helper.hpp"
+#include "entity/history.hpp"
+#include "entity/journal.hpp"
 #include "entity/mixin.hpp"
 #include "entity/observer.hpp"
 #include "entity/organizer.hpp"
@@ -42,6 +44,7 @@
 #include "graph/flow.hpp"
 #include "locator/locator.hpp"
 #include "meta/adl_pointer.hpp"
+#include "meta/archive.hpp"
 #include "meta/container.hpp"
 #include "meta/context.hpp"
 #include "meta/factory.hpp"
@@ -63,5 +66,7 @@
 #include "signal/delegate.hpp"
 #include "signal/dispatcher.hpp"
 #include "signal/emitter.hpp"
+#include "signal/inplace_delegate.hpp"
+#include "signal/mailbox.hpp"
 #include "signal/sigh.hpp"
 // IWYU pragma: end_exports
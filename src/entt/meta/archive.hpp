@@ -0,0 +1,377 @@
+#ifndef ENTT_META_ARCHIVE_HPP
+#define ENTT_META_ARCHIVE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../container/dense_map.hpp"
+#include "../core/fwd.hpp"
+#include "../core/utility.hpp"
+#include "../locator/locator.hpp"
+#include "container.hpp"
+#include "context.hpp"
+#include "fwd.hpp"
+#include "meta.hpp"
+#include "resolve.hpp"
+
+namespace entt {
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
+struct meta_archive_step {
+    std::size_t offset{};
+    std::size_t size{};
+    // only sequence containers have a type, bytes are copied as they are
+    meta_type type{};
+};
+
+class meta_archive_plan {
+    using plan_type = std::vector<meta_archive_step>;
+
+    [[nodiscard]] static std::size_t distance(const void *from, const void *to) noexcept {
+        return static_cast<std::size_t>(static_cast<const std::byte *>(to) - static_cast<const std::byte *>(from));
+    }
+
+    // base classes only contribute their data members, if any
+    [[nodiscard]] static bool members(plan_type &plan, const meta_type &type, const void *instance, const std::size_t offset) {
+        for(auto &&elem: type.base()) {
+            const auto any = type.from_void(instance);
+            const auto other = any.allow_cast(elem.second);
+
+            if(!other || !members(plan, elem.second, other.data(), offset + distance(instance, other.data()))) {
+                return false;
+            }
+        }
+
+        for(auto &&elem: type.data()) {
+            if(elem.second.is_const() || elem.second.is_static()) {
+                continue;
+            }
+
+            // data members registered by means of setters and getters have no address
+            if(const void *field = elem.second.address(instance); !field || !compile(plan, elem.second.type(), field, offset + distance(instance, field))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] static bool compile(plan_type &plan, const meta_type &type, const void *instance, const std::size_t offset) {
+        if(type.data().begin() != type.data().end() || type.base().begin() != type.base().end()) {
+            return members(plan, type, instance, offset);
+        } else if(type.is_sequence_container()) {
+            plan.push_back({offset, 0u, type});
+        } else if(type.is_trivially_copyable() && !type.is_pointer()) {
+            plan.push_back({offset, type.size_of()});
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+public:
+    meta_archive_plan(const meta_ctx &area)
+        : ctx{&area},
+          plans{} {}
+
+    // types that aren't serializable have an invalid plan
+    [[nodiscard]] const plan_type *operator()(const meta_type &type, const void *instance) {
+        if(const auto it = plans.find(type.info().hash()); it != plans.end()) {
+            return it->second.get();
+        }
+
+        auto &elem = plans[type.info().hash()];
+        elem = std::make_unique<plan_type>();
+
+        if(!compile(*elem, type, instance, 0u)) {
+            elem.reset();
+        } else {
+            std::sort(elem->begin(), elem->end(), [](const auto &lhs, const auto &rhs) { return lhs.offset < rhs.offset; });
+
+            if(!elem->empty()) {
+                auto last = elem->begin();
+
+                // adjacent runs of bytes are merged and copied at once
+                for(auto it = last + 1, end = elem->end(); it != end; ++it) {
+                    if(!last->type && !it->type && (it->offset <= (last->offset + last->size))) {
+                        last->size = (std::max)(last->size, it->offset + it->size - last->offset);
+                    } else {
+                        *(++last) = *it;
+                    }
+                }
+
+                elem->erase(++last, elem->end());
+                elem->shrink_to_fit();
+            }
+        }
+
+        return elem.get();
+    }
+
+    [[nodiscard]] const meta_ctx &context() const noexcept {
+        return *ctx;
+    }
+
+private:
+    const meta_ctx *ctx;
+    // plans are stable, nested ones are compiled while visiting their parents
+    dense_map<id_type, std::unique_ptr<plan_type>, identity> plans;
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Binary output archive driven by reflection.
+ *
+ * The first time an object of a given type is serialized, its meta type is
+ * visited once and for all to compile a flat plan of its fields. Nested types
+ * are visited recursively and adjacent fields that are trivially copyable are
+ * merged and copied at once.<br/>
+ * Only data members registered as pointers to data members and that aren't
+ * constant take part in the plan, including those of the reflected base
+ * classes. Sequence containers are supported out of the box, while types
+ * without data members are copied as they are if trivially copyable.<br/>
+ * Any other type isn't serializable and invalidates the archive. This is also
+ * the case of types with writable data members registered by means of setters
+ * and getters.
+ *
+ * This archive is meant to be used with snapshots, as in:
+ *
+ * @code{.cpp}
+ * std::vector<std::byte> buffer{};
+ * entt::meta_output_archive output{buffer};
+ * entt::snapshot{registry}.get<entt::entity>(output).get<position>(output);
+ * @endcode
+ */
+class meta_output_archive {
+    using plan_type = std::vector<internal::meta_archive_step>;
+
+    void write(const void *value, const std::size_t size) {
+        const auto *elem = static_cast<const std::byte *>(value);
+        buffer->insert(buffer->end(), elem, elem + size);
+    }
+
+    [[nodiscard]] bool save(const plan_type *steps, const void *instance) {
+        if(steps == nullptr) {
+            return false;
+        }
+
+        for(auto &&step: *steps) {
+            const auto *elem = static_cast<const std::byte *>(instance) + step.offset;
+
+            if(step.type) {
+                auto container = step.type.from_void(static_cast<const void *>(elem));
+                auto view = container.as_sequence_container();
+                const std::size_t length = view.size();
+                const plan_type *nested = nullptr;
+
+                write(&length, sizeof(length));
+
+                for(auto &&value: view) {
+                    const void *data = std::as_const(value).data();
+                    nested = nested ? nested : plan(value.type(), data);
+
+                    if(!save(nested, data)) {
+                        return false;
+                    }
+                }
+            } else {
+                write(elem, step.size);
+            }
+        }
+
+        return true;
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that writes to a given buffer.
+     * @param output The buffer to write to.
+     */
+    meta_output_archive(std::vector<std::byte> &output)
+        : meta_output_archive{locator<meta_ctx>::value_or(), output} {}
+
+    /**
+     * @brief Context aware constructor.
+     * @param area The context from which to search for meta types.
+     * @param output The buffer to write to.
+     */
+    meta_output_archive(const meta_ctx &area, std::vector<std::byte> &output)
+        : plan{area},
+          buffer{&output},
+          failed{} {}
+
+    /**
+     * @brief Serializes an object.
+     *
+     * Once an object isn't serializable, the archive is no longer valid and
+     * further objects are ignored.
+     *
+     * @tparam Type Type of object to serialize.
+     * @param value The object to serialize.
+     */
+    template<typename Type>
+    void operator()(const Type &value) {
+        if(!failed) {
+            if constexpr(std::is_trivially_copyable_v<Type> && !std::is_class_v<Type>) {
+                write(&value, sizeof(Type));
+            } else {
+                failed = !save(plan(resolve<Type>(plan.context()), &value), &value);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns false if an object wasn't serializable, true otherwise.
+     * @return False if an object wasn't serializable, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return !failed;
+    }
+
+private:
+    internal::meta_archive_plan plan;
+    std::vector<std::byte> *buffer;
+    bool failed;
+};
+
+/**
+ * @brief Binary input archive driven by reflection.
+ *
+ * This is the counterpart of the output archive. Refer to the documentation
+ * of the latter for more details.<br/>
+ * Plans are compiled from the objects to restore. Therefore, the types must be
+ * reflected the same way for both the archives.
+ */
+class meta_input_archive {
+    using plan_type = std::vector<internal::meta_archive_step>;
+
+    [[nodiscard]] bool read(void *value, const std::size_t size) {
+        if(size > (buffer->size() - pos)) {
+            return false;
+        }
+
+        std::memcpy(value, buffer->data() + pos, size);
+        pos += size;
+        return true;
+    }
+
+    // elements take at least a byte each, unless there is nothing to restore
+    [[nodiscard]] bool fits(const meta_sequence_container &view, const std::size_t length) {
+        if(length <= (buffer->size() - pos)) {
+            return true;
+        }
+
+        auto value = view.value_type().construct();
+        const auto *steps = value ? plan(value.type(), value.data()) : nullptr;
+        return steps && steps->empty();
+    }
+
+    [[nodiscard]] bool load(const plan_type *steps, void *instance) {
+        if(steps == nullptr) {
+            return false;
+        }
+
+        for(auto &&step: *steps) {
+            auto *elem = static_cast<std::byte *>(instance) + step.offset;
+
+            if(step.type) {
+                auto container = step.type.from_void(static_cast<void *>(elem));
+                auto view = container.as_sequence_container();
+                std::size_t length{};
+                const plan_type *nested = nullptr;
+
+                if(!read(&length, sizeof(length)) || (view.size() != length && (!fits(view, length) || !view.resize(length)))) {
+                    return false;
+                }
+
+                for(auto &&value: view) {
+                    nested = nested ? nested : plan(value.type(), value.data());
+
+                    if(!load(nested, value.data())) {
+                        return false;
+                    }
+                }
+            } else if(!read(elem, step.size)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+public:
+    /**
+     * @brief Constructs an archive that reads from a given buffer.
+     * @param input The buffer to read from.
+     */
+    meta_input_archive(const std::vector<std::byte> &input)
+        : meta_input_archive{locator<meta_ctx>::value_or(), input} {}
+
+    /**
+     * @brief Context aware constructor.
+     * @param area The context from which to search for meta types.
+     * @param input The buffer to read from.
+     */
+    meta_input_archive(const meta_ctx &area, const std::vector<std::byte> &input)
+        : plan{area},
+          buffer{&input},
+          pos{},
+          failed{} {}
+
+    /**
+     * @brief Restores an object.
+     *
+     * Once an object cannot be restored, either because it isn't serializable
+     * or because the input is truncated or malformed, the archive is no longer
+     * valid and further objects are left untouched. The object that couldn't
+     * be restored is left in a valid but unspecified state.
+     *
+     * @tparam Type Type of object to restore.
+     * @param value The object to restore.
+     */
+    template<typename Type>
+    void operator()(Type &value) {
+        if(!failed) {
+            if constexpr(std::is_trivially_copyable_v<Type> && !std::is_class_v<Type>) {
+                failed = !read(&value, sizeof(Type));
+            } else {
+                failed = !load(plan(resolve<Type>(plan.context()), &value), &value);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns false if an object couldn't be restored, true otherwise.
+     * @return False if an object couldn't be restored, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return !failed;
+    }
+
+    /**
+     * @brief Returns the number of bytes read so far.
+     * @return The number of bytes read so far.
+     */
+    [[nodiscard]] std::size_t position() const noexcept {
+        return pos;
+    }
+
+private:
+    internal::meta_archive_plan plan;
+    const std::vector<std::byte> *buffer;
+    std::size_t pos;
+    bool failed;
+};
+
+} // namespace entt
+
+#endif
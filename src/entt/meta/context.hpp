@@ -1,6 +1,8 @@
 #ifndef ENTT_META_CTX_HPP
 #define ENTT_META_CTX_HPP
 
+#include <memory>
+#include <vector>
 #include "../container/dense_map.hpp"
 #include "../core/fwd.hpp"
 #include "../core/utility.hpp"
@@ -13,9 +15,30 @@ class meta_ctx;
 namespace internal {
 
 struct meta_type_node;
+struct meta_conv_node;
+
+struct meta_path_node {
+    // base classes to walk through in order, from the source type to the target type
+    std::vector<const void *(*)(const void *) noexcept> step{};
+    // either the target type or the conversion function to use to reach it, if any
+    const meta_type_node *type{};
+    const meta_conv_node *conv{};
+};
+
+// source type to target type to path, see meta_prepare_paths
+using meta_path_cache = dense_map<id_type, dense_map<id_type, meta_path_node, identity>, identity>;
 
 struct meta_context {
-    dense_map<id_type, meta_type_node, identity> value{};
+    // nodes are never moved, meta objects refer to them directly
+    dense_map<id_type, std::unique_ptr<meta_type_node>, identity> value{};
+    // user defined identifiers to type hashes, types with a default identifier aren't indexed
+    dense_map<id_type, id_type, identity> index{};
+    // paths through base classes, only frozen contexts resolve them in advance
+    meta_path_cache cast{};
+    // as above, also taking conversion functions into account
+    meta_path_cache conv{};
+    // frozen contexts are compact and read-only, see meta_freeze
+    bool frozen{};
 
     [[nodiscard]] inline static meta_context &from(meta_ctx &ctx);
     [[nodiscard]] inline static const meta_context &from(const meta_ctx &ctx);
@@ -8,6 +8,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
 #include "../core/bit.hpp"
 #include "../core/fwd.hpp"
@@ -40,23 +41,41 @@ class basic_meta_factory {
         return curr;
     }
 
+    // factories created for frozen contexts work on a detached node
+    [[nodiscard]] meta_type_node &node() const noexcept {
+        return detached ? *detached : *meta_context::from(*ctx).value[parent];
+    }
+
 protected:
     void type(const id_type id) noexcept {
-        auto &&elem = meta_context::from(*ctx).value[parent];
-        ENTT_ASSERT(elem.id == id || !resolve(*ctx, id), "Duplicate identifier");
+        auto &&elem = node();
+
+        if(!detached) {
+            auto &&context = meta_context::from(*ctx);
+            ENTT_ASSERT(elem.id == id || !resolve(*ctx, id), "Duplicate identifier");
+
+            if(elem.id != parent) {
+                context.index.erase(elem.id);
+            }
+
+            if(id != parent) {
+                context.index.insert_or_assign(id, parent);
+            }
+        }
+
         invoke = nullptr;
         bucket = parent;
         elem.id = id;
     }
 
-    void base(const id_type id, meta_base_node node) {
-        details->base.insert_or_assign(id, node);
+    void base(const id_type id, meta_base_node elem) {
+        details->base.insert_or_assign(id, elem);
         invoke = nullptr;
         bucket = parent;
     }
 
-    void conv(const id_type id, meta_conv_node node) {
-        details->conv.insert_or_assign(id, node);
+    void conv(const id_type id, meta_conv_node elem) {
+        details->conv.insert_or_assign(id, elem);
         invoke = nullptr;
         bucket = parent;
     }
@@ -67,8 +86,8 @@ protected:
         bucket = parent;
     }
 
-    void dtor(meta_dtor_node node) {
-        meta_context::from(*ctx).value[parent].dtor = node;
+    void dtor(meta_dtor_node elem) {
+        node().dtor = elem;
         invoke = nullptr;
         bucket = parent;
     }
@@ -120,7 +139,7 @@ protected:
 
     void traits(const meta_traits value) {
         if(bucket == parent) {
-            meta_context::from(*ctx).value[bucket].traits |= value;
+            node().traits |= value;
         } else if(invoke == nullptr) {
             details->data[bucket].traits |= value;
         } else {
@@ -128,13 +147,13 @@ protected:
         }
     }
 
-    void custom(meta_custom_node node) {
+    void custom(meta_custom_node elem) {
         if(bucket == parent) {
-            meta_context::from(*ctx).value[bucket].custom = std::move(node);
+            node().custom = std::move(elem);
         } else if(invoke == nullptr) {
-            details->data[bucket].custom = std::move(node);
+            details->data[bucket].custom = std::move(elem);
         } else {
-            find_overload()->custom = std::move(node);
+            find_overload()->custom = std::move(elem);
         }
     }
 
@@ -143,7 +162,13 @@ public:
         : ctx{&area},
           parent{id},
           bucket{id} {
-        auto &&elem = meta_context::from(*ctx).value[parent];
+        ENTT_ASSERT(!meta_context::from(*ctx).frozen, "Frozen context");
+
+        if(meta_context::from(*ctx).frozen) {
+            detached = std::make_shared<meta_type_node>();
+        }
+
+        auto &&elem = node();
 
         if(!elem.details) {
             elem.details = std::make_shared<meta_type_descriptor>();
@@ -158,8 +183,126 @@ private:
     id_type bucket{};
     invoke_type *invoke{};
     meta_type_descriptor *details{};
+    std::shared_ptr<meta_type_node> detached{};
 };
 
+template<typename Map>
+void meta_compact(Map &map) {
+    Map other{};
+    other.reserve(map.size());
+
+    for(auto &&elem: map) {
+        other.emplace(elem.first, std::move(elem.second));
+    }
+
+    map = std::move(other);
+}
+
+template<typename Type>
+void meta_compact(meta_flat_map<Type> &map) {
+    map.shrink_to_fit();
+}
+
+inline void meta_compact(meta_func_node &node) {
+    std::size_t count{};
+
+    for(auto *curr = node.next.get(); curr; curr = curr->next.get()) {
+        ++count;
+    }
+
+    meta_compact(node.prop);
+
+    if(count != 0u) {
+        auto block = std::make_shared<std::vector<meta_func_node>>();
+        block->reserve(count);
+
+        for(auto curr = std::move(node.next); curr;) {
+            auto next = std::move(curr->next);
+            meta_compact(curr->prop);
+            block->push_back(std::move(*curr));
+            curr = std::move(next);
+        }
+
+        // overloads don't own their successors, it would create a cycle otherwise
+        for(std::size_t pos{1u}; pos < count; ++pos) {
+            (*block)[pos - 1u].next = std::shared_ptr<meta_func_node>{std::shared_ptr<void>{}, &(*block)[pos]};
+        }
+
+        node.next = std::shared_ptr<meta_func_node>{block, block->data()};
+    }
+}
+
+inline void meta_compact(meta_type_descriptor &elem) {
+    meta_compact(elem.ctor);
+    meta_compact(elem.base);
+    meta_compact(elem.conv);
+    meta_compact(elem.data);
+    meta_compact(elem.func);
+    meta_compact(elem.prop);
+
+    for(auto &&curr: elem.data) {
+        meta_compact(curr.second.prop);
+    }
+
+    for(auto &&curr: elem.func) {
+        meta_compact(curr.second);
+    }
+}
+
+// parts of the destination always win over those of the source
+template<typename Type>
+void meta_merge(meta_flat_map<Type> &to, meta_flat_map<Type> &from) {
+    for(auto &&elem: from) {
+        if(!to.contains(elem.first)) {
+            to.insert_or_assign(elem.first, std::move(elem.second));
+        }
+    }
+}
+
+inline void meta_merge(meta_flat_map<meta_func_node> &to, meta_flat_map<meta_func_node> &from) {
+    for(auto &&elem: from) {
+        if(auto it = to.find(elem.first); it == to.end()) {
+            to.insert_or_assign(elem.first, std::move(elem.second));
+        } else {
+            for(const auto *curr = &elem.second; curr; curr = curr->next.get()) {
+                auto *last = &it->second;
+
+                while(last->invoke != curr->invoke && last->next) {
+                    last = last->next.get();
+                }
+
+                if(last->invoke != curr->invoke) {
+                    last->next = std::make_shared<meta_func_node>(*curr);
+                    last->next->next.reset();
+                }
+            }
+        }
+    }
+}
+
+inline void meta_merge(meta_type_node &to, meta_type_node &from) {
+    to.traits |= from.traits;
+
+    if(!to.dtor.dtor) {
+        to.dtor = from.dtor;
+    }
+
+    if(!to.custom.value) {
+        to.custom = std::move(from.custom);
+    }
+
+    if(!to.details) {
+        to.details = std::move(from.details);
+    } else if(from.details) {
+        meta_merge(to.details->ctor, from.details->ctor);
+        meta_merge(to.details->base, from.details->base);
+        meta_merge(to.details->conv, from.details->conv);
+        meta_merge(to.details->data, from.details->data);
+        meta_merge(to.details->func, from.details->func);
+        meta_merge(to.details->prop, from.details->prop);
+    }
+}
+
 } // namespace internal
 /*! @endcond */
 
@@ -186,7 +329,9 @@ class meta_factory: private internal::basic_meta_factory {
                 &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
                 &meta_arg<type_list<type_list_element_t<type_list_element_t<Index, args_type>::size != 1u, type_list_element_t<Index, args_type>>...>>,
                 +[](meta_handle instance, meta_any value) { return (meta_setter<Type, value_list_element_v<Index, Setter>>(*instance.operator->(), value.as_ref()) || ...); },
-                &meta_getter<Type, Getter, Policy>});
+                &meta_getter<Type, Getter, Policy>,
+                &type_id<Type>(),
+                internal::meta_bound_getter<Type, Getter, Policy>()});
     }
 
 public:
@@ -361,7 +506,10 @@ public:
                     &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
                     &meta_arg<type_list<std::remove_cv_t<std::remove_reference_t<data_type>>>>,
                     &meta_setter<Type, Data>,
-                    &meta_getter<Type, Data, Policy>});
+                    &meta_getter<Type, Data, Policy>,
+                    &type_id<Type>(),
+                    internal::meta_bound_getter<Type, Data, Policy>(),
+                    +[](const void *instance) noexcept -> const void * { return std::addressof(static_cast<const Type *>(instance)->*Data); }});
         } else {
             using data_type = std::remove_pointer_t<decltype(Data)>;
 
@@ -379,7 +527,9 @@ public:
                     &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
                     &meta_arg<type_list<std::remove_cv_t<std::remove_reference_t<data_type>>>>,
                     &meta_setter<Type, Data>,
-                    &meta_getter<Type, Data, Policy>});
+                    &meta_getter<Type, Data, Policy>,
+                    &type_id<Type>(),
+                    internal::meta_bound_getter<Type, Data, Policy>()});
         }
 
         return *this;
@@ -420,7 +570,9 @@ public:
                     &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
                     &meta_arg<type_list<>>,
                     &meta_setter<Type, Setter>,
-                    &meta_getter<Type, Getter, Policy>});
+                    &meta_getter<Type, Getter, Policy>,
+                    &type_id<Type>(),
+                    internal::meta_bound_getter<Type, Getter, Policy>()});
         } else {
             using args_type = typename meta_function_helper_t<Type, decltype(Setter)>::args_type;
 
@@ -433,7 +585,9 @@ public:
                     &internal::resolve<std::remove_cv_t<std::remove_reference_t<data_type>>>,
                     &meta_arg<type_list<type_list_element_t<args_type::size != 1u, args_type>>>,
                     &meta_setter<Type, Setter>,
-                    &meta_getter<Type, Getter, Policy>});
+                    &meta_getter<Type, Getter, Policy>,
+                    &type_id<Type>(),
+                    internal::meta_bound_getter<Type, Getter, Policy>()});
         }
 
         return *this;
@@ -487,7 +641,9 @@ public:
                 descriptor::args_type::size,
                 &internal::resolve<std::conditional_t<std::is_same_v<Policy, as_void_t>, void, std::remove_cv_t<std::remove_reference_t<typename descriptor::return_type>>>>,
                 &meta_arg<typename descriptor::args_type>,
-                &meta_invoke<Type, Candidate, Policy>});
+                &meta_invoke<Type, Candidate, Policy>,
+                &type_id<Type>(),
+                internal::meta_bound_invoke<Type, Candidate, Policy>(std::make_index_sequence<descriptor::args_type::size>{})});
 
         return *this;
     }
@@ -558,8 +714,13 @@ public:
 template<typename Type>
 [[nodiscard]] auto meta(meta_ctx &ctx) noexcept {
     auto &&context = internal::meta_context::from(ctx);
+    ENTT_ASSERT(!context.frozen, "Frozen context");
+
     // make sure the type exists in the context before returning a factory
-    context.value.try_emplace(type_id<Type>().hash(), internal::resolve<Type>(context));
+    if(!context.frozen && !context.value.contains(type_id<Type>().hash())) {
+        context.value.emplace(type_id<Type>().hash(), std::make_unique<internal::meta_type_node>(internal::resolve<Type>(context)));
+    }
+
     return meta_factory<Type>{ctx};
 }
 
@@ -593,13 +754,11 @@ template<typename Type>
  */
 inline void meta_reset(meta_ctx &ctx, const id_type id) noexcept {
     auto &&context = internal::meta_context::from(ctx);
+    ENTT_ASSERT(!context.frozen, "Frozen context");
 
-    for(auto it = context.value.begin(); it != context.value.end();) {
-        if(it->second.id == id) {
-            it = context.value.erase(it);
-        } else {
-            ++it;
-        }
+    if(const auto *elem = internal::try_resolve(context, id); elem && !context.frozen) {
+        context.value.erase(elem->info->hash());
+        context.index.erase(id);
     }
 }
 
@@ -628,7 +787,16 @@ inline void meta_reset(const id_type id) noexcept {
  */
 template<typename Type>
 void meta_reset(meta_ctx &ctx) noexcept {
-    internal::meta_context::from(ctx).value.erase(type_id<Type>().hash());
+    auto &&context = internal::meta_context::from(ctx);
+    ENTT_ASSERT(!context.frozen, "Frozen context");
+
+    if(const auto it = context.value.find(type_id<Type>().hash()); it != context.value.end() && !context.frozen) {
+        if(it->second->id != it->first) {
+            context.index.erase(it->second->id);
+        }
+
+        context.value.erase(it);
+    }
 }
 
 /**
@@ -651,7 +819,11 @@ void meta_reset() noexcept {
  * @param ctx The context from which to reset meta types.
  */
 inline void meta_reset(meta_ctx &ctx) noexcept {
-    internal::meta_context::from(ctx).value.clear();
+    auto &&context = internal::meta_context::from(ctx);
+    internal::meta_reset_paths(context);
+    context.value.clear();
+    context.index.clear();
+    context.frozen = false;
 }
 
 /**
@@ -663,6 +835,135 @@ inline void meta_reset() noexcept {
     meta_reset(locator<meta_ctx>::value_or());
 }
 
+/**
+ * @brief Moves all meta types from a context to another one.
+ *
+ * Registering types isn't thread safe. However, different threads can register
+ * their types into different (staging) contexts at the same time. Staging
+ * contexts are then merged into the shared one at once.<br/>
+ * Meta types are neither rebuilt nor copied. Merging only transfers their
+ * ownership and is therefore cheap, no matter how much has been registered.
+ *
+ * Types that are already part of the destination context keep their meta type
+ * and receive the parts they lack from the source context, overloads of member
+ * functions included. On conflicts, that is, parts with the same identifier or
+ * types with different custom identifiers, the destination always wins.<br/>
+ * The source context is empty after a merge.
+ *
+ * @warning
+ * Meta objects obtained from the source context still refer to it. Types that
+ * are merged must be resolved again from the destination context. As with
+ * registration, parts added to existing types invalidate the meta objects
+ * obtained for their parts, but not meta types nor meta any objects.<br/>
+ * Merging isn't thread safe with respect to the destination context, which
+ * can be frozen afterwards to read from it concurrently.
+ *
+ * @param ctx The context into which to move meta types.
+ * @param other The context from which to move meta types.
+ */
+inline void meta_merge(meta_ctx &ctx, meta_ctx &other) {
+    auto &&context = internal::meta_context::from(ctx);
+    auto &&source = internal::meta_context::from(other);
+    ENTT_ASSERT(!context.frozen && !source.frozen, "Frozen context");
+
+    if(context.frozen || source.frozen || (&context == &source)) {
+        return;
+    }
+
+    for(auto &&elem: source.value) {
+        const auto id = elem.second->id;
+        auto it = context.value.find(elem.first);
+        // types that are already part of the destination keep their identifier
+        const bool rename = (id != elem.first) && (it == context.value.end() || it->second->id == elem.first);
+
+        if(it == context.value.end()) {
+            it = context.value.emplace(elem.first, std::move(elem.second)).first;
+        } else {
+            internal::meta_merge(*it->second, *elem.second);
+        }
+
+        if(rename) {
+            ENTT_ASSERT(!internal::try_resolve(context, id), "Duplicate identifier");
+            context.index.insert_or_assign(id, elem.first);
+            it->second->id = id;
+        }
+    }
+
+    source.value.clear();
+    source.index.clear();
+}
+
+/**
+ * @brief Freezes a context and compacts all its meta types.
+ *
+ * Meta types and their parts are packed in a few contiguous blocks of memory
+ * and lookup tables are shrunk to fit. Types that only have a name and no parts
+ * don't use extra memory at all.<br/>
+ * A frozen context is read-only. Any attempt to register, reset or merge a
+ * type triggers an assertion in debug mode and is ignored otherwise. In
+ * particular, meta factories for a frozen context work on types that aren't
+ * part of the context. On the other hand, it's safe to read from a frozen
+ * context concurrently from multiple threads without synchronization.<br/>
+ * Resetting all types at once is the only way to _unfreeze_ a context.
+ *
+ * @warning
+ * Meta objects obtained from a context before freezing it are invalidated, with
+ * the exception of meta types and meta any objects.
+ *
+ * @param ctx The context to freeze.
+ */
+inline void meta_freeze(meta_ctx &ctx) {
+    auto &&context = internal::meta_context::from(ctx);
+
+    if(!context.frozen) {
+        const auto is_empty = [](const internal::meta_type_descriptor &elem) {
+            return elem.ctor.empty() && elem.base.empty() && elem.conv.empty() && elem.data.empty() && elem.func.empty() && elem.prop.empty();
+        };
+
+        std::size_t count{};
+
+        for(auto &&elem: context.value) {
+            if(auto &&node = *elem.second; node.details && is_empty(*node.details)) {
+                node.details.reset();
+            } else {
+                count += static_cast<bool>(node.details);
+            }
+        }
+
+        auto block = std::make_shared<std::vector<internal::meta_type_descriptor>>();
+        block->reserve(count);
+
+        for(auto &&elem: context.value) {
+            if(auto &&node = *elem.second; node.details) {
+                auto &&curr = block->emplace_back(std::move(*node.details));
+                internal::meta_compact(curr);
+                node.details = std::shared_ptr<internal::meta_type_descriptor>{block, &curr};
+            }
+        }
+
+        internal::meta_compact(context.value);
+        internal::meta_compact(context.index);
+        internal::meta_reset_paths(context);
+
+        // frozen contexts are read-only, all paths are resolved in advance
+        for(auto &&elem: context.value) {
+            if(auto &&node = *elem.second; node.details && !node.details->base.empty()) {
+                internal::meta_prepare_paths(context, node, node);
+            }
+        }
+
+        context.frozen = true;
+    }
+}
+
+/**
+ * @brief Freezes the default context and compacts all its meta types.
+ * @sa meta_freeze
+ */
+inline void meta_freeze() {
+    meta_freeze(locator<meta_ctx>::value_or());
+}
+
 } // namespace entt
 
 #endif
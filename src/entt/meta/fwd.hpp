@@ -19,8 +19,15 @@ struct meta_data;
 
 struct meta_func;
 
+template<typename, typename...>
+class meta_invoker;
+
 class meta_type;
 
+class meta_output_archive;
+
+class meta_input_archive;
+
 } // namespace entt
 
 #endif
@@ -82,8 +82,8 @@ public:
 
 private:
     const meta_ctx *ctx{&locator<meta_ctx>::value_or()};
-    internal::meta_type_node (*value_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*const_reference_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*value_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*const_reference_node)(const internal::meta_context &){};
     size_type (*size_fn)(const void *){};
     bool (*clear_fn)(void *){};
     bool (*reserve_fn)(void *, const size_type){};
@@ -157,9 +157,9 @@ public:
 
 private:
     const meta_ctx *ctx{&locator<meta_ctx>::value_or()};
-    internal::meta_type_node (*key_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*mapped_type_node)(const internal::meta_context &){};
-    internal::meta_type_node (*value_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*key_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*mapped_type_node)(const internal::meta_context &){};
+    const internal::meta_type_node &(*value_type_node)(const internal::meta_context &){};
     size_type (*size_fn)(const void *){};
     bool (*clear_fn)(void *){};
     bool (*reserve_fn)(void *, const size_type){};
@@ -177,6 +177,7 @@ using meta_any_policy = any_policy;
 
 /*! @brief Opaque wrapper for values of any type. */
 class meta_any {
+    using any_type = basic_any<ENTT_META_ANY_SBO>;
     using vtable_type = void(const internal::meta_traits op, const bool, const void *, void *);
 
     template<typename Type>
@@ -213,15 +214,15 @@ class meta_any {
     }
 
     void release() {
-        if(node.dtor.dtor && (storage.policy() == any_policy::owner)) {
-            node.dtor.dtor(storage.data());
+        if(node->dtor.dtor && (storage.policy() == any_policy::owner)) {
+            node->dtor.dtor(storage.data());
         }
     }
 
-    meta_any(const meta_any &other, any ref) noexcept
+    meta_any(const meta_any &other, any_type ref) noexcept
         : storage{std::move(ref)},
           ctx{other.ctx},
-          node{storage ? other.node : internal::meta_type_node{}},
+          node{storage ? other.node : &internal::meta_null_type_node()},
           vtable{storage ? other.vtable : &basic_vtable<void>} {}
 
 public:
@@ -256,7 +257,7 @@ public:
     explicit meta_any(const meta_ctx &area, std::in_place_type_t<Type>, Args &&...args)
         : storage{std::in_place_type<Type>, std::forward<Args>(args)...},
           ctx{&area},
-          node{internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))},
+          node{&internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx))},
           vtable{&basic_vtable<std::remove_cv_t<std::remove_reference_t<Type>>>} {}
 
     /**
@@ -286,7 +287,7 @@ public:
     meta_any(const meta_ctx &area, const meta_any &other)
         : storage{other.storage},
           ctx{&area},
-          node{other.node.resolve ? other.node.resolve(internal::meta_context::from(*ctx)) : other.node},
+          node{other.node->resolve ? &other.node->resolve(internal::meta_context::from(*ctx)) : other.node},
           vtable{other.vtable} {}
 
     /**
@@ -297,7 +298,7 @@ public:
     meta_any(const meta_ctx &area, meta_any &&other)
         : storage{std::move(other.storage)},
           ctx{&area},
-          node{other.node.resolve ? std::exchange(other.node, internal::meta_type_node{}).resolve(internal::meta_context::from(*ctx)) : std::exchange(other.node, internal::meta_type_node{})},
+          node{other.node->resolve ? &std::exchange(other.node, &internal::meta_null_type_node())->resolve(internal::meta_context::from(*ctx)) : std::exchange(other.node, &internal::meta_null_type_node())},
           vtable{std::exchange(other.vtable, &basic_vtable<void>)} {}
 
     /**
@@ -313,7 +314,7 @@ public:
     meta_any(meta_any &&other) noexcept
         : storage{std::move(other.storage)},
           ctx{other.ctx},
-          node{std::exchange(other.node, internal::meta_type_node{})},
+          node{std::exchange(other.node, &internal::meta_null_type_node())},
           vtable{std::exchange(other.vtable, &basic_vtable<void>)} {}
 
     /*! @brief Frees the internal storage, whatever it means. */
@@ -349,7 +350,7 @@ public:
         release();
         storage = std::move(other.storage);
         ctx = other.ctx;
-        node = std::exchange(other.node, internal::meta_type_node{});
+        node = std::exchange(other.node, &internal::meta_null_type_node());
         vtable = std::exchange(other.vtable, &basic_vtable<void>);
         return *this;
     }
@@ -420,8 +421,8 @@ public:
      */
     template<typename Type>
     [[nodiscard]] const Type *try_cast() const {
-        const auto other = internal::resolve<std::remove_cv_t<Type>>(internal::meta_context::from(*ctx));
-        return static_cast<const Type *>(internal::try_cast(internal::meta_context::from(*ctx), node, other, data()));
+        const auto &other = internal::resolve<std::remove_cv_t<Type>>(internal::meta_context::from(*ctx));
+        return static_cast<const Type *>(internal::try_cast(internal::meta_context::from(*ctx), *node, other, data()));
     }
 
     /*! @copydoc try_cast */
@@ -430,8 +431,8 @@ public:
         if constexpr(std::is_const_v<Type>) {
             return std::as_const(*this).try_cast<std::remove_const_t<Type>>();
         } else {
-            const auto other = internal::resolve<std::remove_cv_t<Type>>(internal::meta_context::from(*ctx));
-            return static_cast<Type *>(const_cast<void *>(internal::try_cast(internal::meta_context::from(*ctx), node, other, data())));
+            const auto &other = internal::resolve<std::remove_cv_t<Type>>(internal::meta_context::from(*ctx));
+            return static_cast<Type *>(const_cast<void *>(internal::try_cast(internal::meta_context::from(*ctx), *node, other, data())));
         }
     }
 
@@ -492,7 +493,7 @@ public:
         if constexpr(std::is_reference_v<Type> && !std::is_const_v<std::remove_reference_t<Type>>) {
             return meta_any{meta_ctx_arg, *ctx};
         } else {
-            auto other = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
+            const auto &other = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
             return allow_cast(meta_type{*ctx, other});
         }
     }
@@ -504,7 +505,7 @@ public:
      */
     template<typename Type>
     [[nodiscard]] bool allow_cast() {
-        auto other = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
+        const auto &other = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
         return allow_cast(meta_type{*ctx, other}) && (!(std::is_reference_v<Type> && !std::is_const_v<std::remove_reference_t<Type>>) || storage.data() != nullptr);
     }
 
@@ -513,7 +514,7 @@ public:
     void emplace(Args &&...args) {
         release();
         storage.emplace<Type>(std::forward<Args>(args)...);
-        node = internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
+        node = &internal::resolve<std::remove_cv_t<std::remove_reference_t<Type>>>(internal::meta_context::from(*ctx));
         vtable = &basic_vtable<std::remove_cv_t<std::remove_reference_t<Type>>>;
     }
 
@@ -527,7 +528,7 @@ public:
     void reset() {
         release();
         storage.reset();
-        node = {};
+        node = &internal::meta_null_type_node();
         vtable = &basic_vtable<void>;
     }
 
@@ -581,12 +582,12 @@ public:
      * @return False if the wrapper is invalid, true otherwise.
      */
     [[nodiscard]] explicit operator bool() const noexcept {
-        return !(node.info == nullptr);
+        return !(node->info == nullptr);
     }
 
     /*! @copydoc any::operator== */
     [[nodiscard]] bool operator==(const meta_any &other) const noexcept {
-        return (ctx == other.ctx) && ((!node.info && !other.node.info) || (node.info && other.node.info && *node.info == *other.node.info && storage == other.storage));
+        return (ctx == other.ctx) && ((!node->info && !other.node->info) || (node->info && other.node->info && *node->info == *other.node->info && storage == other.storage));
     }
 
     /*! @copydoc any::operator!= */
@@ -613,9 +614,9 @@ public:
     }
 
 private:
-    any storage{};
+    any_type storage{};
     const meta_ctx *ctx{&locator<meta_ctx>::value_or()};
-    internal::meta_type_node node{};
+    const internal::meta_type_node *node{&internal::meta_null_type_node()};
     vtable_type *vtable{&basic_vtable<void>};
 };
 
@@ -861,6 +862,65 @@ private:
     internal::meta_custom_node node{};
 };
 
+/**
+ * @brief Invoker bound to a member function or a data member and to the exact
+ * types of its instance and arguments.
+ *
+ * Invokers skip both the lookup and the conversion of the arguments. Instances
+ * and arguments are forwarded as they are, without wrapping them in meta any
+ * objects.
+ *
+ * @tparam Type Type of the instance, `void` for static members.
+ * @tparam Args Types of arguments.
+ */
+template<typename Type, typename... Args>
+class meta_invoker {
+    using invoke_type = meta_any(const meta_ctx &, void *, const void *, const void *const *);
+
+public:
+    /*! @brief Default constructor. */
+    meta_invoker() noexcept = default;
+
+    /**
+     * @brief Context aware constructor for meta objects.
+     * @param area The context from which to search for meta types.
+     * @param func The underlying function to use to invoke the member.
+     */
+    meta_invoker(const meta_ctx &area, invoke_type *func) noexcept
+        : ctx{&area},
+          invoke{func} {}
+
+    /**
+     * @brief Invokes the underlying member.
+     * @param instance A pointer to an instance of the underlying type, if any.
+     * @param args Parameters to use to invoke the member.
+     * @return A wrapper containing the returned value, if any.
+     */
+    // NOLINTNEXTLINE(modernize-use-nodiscard)
+    meta_any operator()(Type *instance, const Args &...args) const {
+        ENTT_ASSERT(invoke != nullptr, "Invalid invoker");
+        const std::array<const void *, sizeof...(Args)> arguments{std::addressof(args)...};
+
+        if constexpr(std::is_const_v<Type>) {
+            return invoke(*ctx, nullptr, instance, arguments.data());
+        } else {
+            return invoke(*ctx, instance, instance, arguments.data());
+        }
+    }
+
+    /**
+     * @brief Returns true if an object is valid, false otherwise.
+     * @return True if the object is valid, false otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return (invoke != nullptr);
+    }
+
+private:
+    const meta_ctx *ctx{};
+    invoke_type *invoke{};
+};
+
 /*! @brief Opaque wrapper for data members. */
 struct meta_data {
     /*! @brief Unsigned integer type. */
@@ -927,6 +987,38 @@ struct meta_data {
         return node->get(*ctx, meta_handle{*ctx, std::move(instance)});
     }
 
+    /**
+     * @brief Binds the getter of a data member to a given type of instance.
+     *
+     * The type of the instance must be that of the type the data member was
+     * registered with, or `void` for static data members.
+     *
+     * @tparam Type Type of the instance, possibly const qualified.
+     * @return A valid invoker in case of success, an invalid one otherwise.
+     */
+    template<typename Type>
+    [[nodiscard]] meta_invoker<Type> bind() const noexcept {
+        if(node->bound && (static_cast<bool>(node->traits & internal::meta_traits::is_static) || (node->owner && *node->owner == type_id<Type>()))) {
+            return meta_invoker<Type>{*ctx, node->bound};
+        }
+
+        return meta_invoker<Type>{};
+    }
+
+    /**
+     * @brief Returns the address of a data member within a given instance.
+     *
+     * Only data members registered as pointers to data members have an
+     * address. Static data members and those registered by means of setters
+     * and getters don't.
+     *
+     * @param instance An opaque pointer to an instance of the underlying type.
+     * @return The address of the data member, if any, a null pointer otherwise.
+     */
+    [[nodiscard]] const void *address(const void *instance) const noexcept {
+        return (node->address && instance) ? node->address(instance) : nullptr;
+    }
+
     /**
      * @brief Returns the type accepted by the i-th setter.
      * @param index Index of the setter of which to return the accepted type.
@@ -1077,6 +1169,37 @@ struct meta_func {
         return invoke(std::move(instance), arguments.data(), sizeof...(Args));
     }
 
+    /**
+     * @brief Binds a member function to the exact types of its arguments.
+     *
+     * The function and its overloads, if any, are searched for a candidate
+     * that accepts exactly the given types of arguments, without conversions.
+     * The type of the instance must be that of the type the function was
+     * registered with, or `void` for static functions.<br/>
+     * Functions that take their arguments by non-const reference cannot be
+     * bound.
+     *
+     * @tparam Type Type of the instance, possibly const qualified.
+     * @tparam Args Types of arguments to use to invoke the function.
+     * @return A valid invoker in case of success, an invalid one otherwise.
+     */
+    template<typename Type, typename... Args>
+    [[nodiscard]] meta_invoker<Type, Args...> bind() const {
+        for(auto *curr = node; curr; curr = curr->next.get()) {
+            if(curr->bound && curr->arity == sizeof...(Args)) {
+                if(static_cast<bool>(curr->traits & internal::meta_traits::is_static) || (curr->owner && *curr->owner == type_id<Type>() && (!std::is_const_v<Type> || static_cast<bool>(curr->traits & internal::meta_traits::is_const)))) {
+                    [[maybe_unused]] size_type pos{};
+
+                    if(((curr->arg(*ctx, pos++).info() == type_id<Args>()) && ...)) {
+                        return meta_invoker<Type, Args...>{*ctx, curr->bound};
+                    }
+                }
+            }
+        }
+
+        return meta_invoker<Type, Args...>{};
+    }
+
     /*! @copydoc meta_data::prop */
     [[nodiscard]] meta_range<meta_prop, typename decltype(internal::meta_func_node::prop)::const_iterator> prop() const noexcept {
         return {{*ctx, node->prop.cbegin()}, {*ctx, node->prop.cend()}};
@@ -1165,7 +1288,7 @@ class meta_type {
 
                     if(const auto &info = other.info(); info == type.info()) {
                         ++match;
-                    } else if(!((type.node.details && (type.node.details->base.contains(info.hash()) || type.node.details->conv.contains(info.hash()))) || (type.node.conversion_helper && other.node.conversion_helper))) {
+                    } else if(!((type.node->details && (type.node->details->base.contains(info.hash()) || type.node->details->conv.contains(info.hash()))) || (type.node->conversion_helper && other.node->conversion_helper))) {
                         break;
                     }
                 }
@@ -1206,8 +1329,8 @@ public:
      * @param area The context from which to search for meta types.
      * @param curr The underlying node with which to construct the instance.
      */
-    meta_type(const meta_ctx &area, internal::meta_type_node curr) noexcept
-        : node{std::move(curr)},
+    meta_type(const meta_ctx &area, const internal::meta_type_node &curr) noexcept
+        : node{&curr},
           ctx{&area} {}
 
     /**
@@ -1223,7 +1346,7 @@ public:
      * @return The type info object of the underlying type.
      */
     [[nodiscard]] const type_info &info() const noexcept {
-        return *node.info;
+        return *node->info;
     }
 
     /**
@@ -1231,7 +1354,7 @@ public:
      * @return The identifier assigned to the type.
      */
     [[nodiscard]] id_type id() const noexcept {
-        return node.id;
+        return node->id;
     }
 
     /**
@@ -1239,7 +1362,7 @@ public:
      * @return The size of the underlying type if known, 0 otherwise.
      */
     [[nodiscard]] size_type size_of() const noexcept {
-        return node.size_of;
+        return node->size_of;
     }
 
     /**
@@ -1248,7 +1371,7 @@ public:
      * otherwise.
      */
     [[nodiscard]] bool is_arithmetic() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_arithmetic);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_arithmetic);
     }
 
     /**
@@ -1256,7 +1379,7 @@ public:
      * @return True if the underlying type is an integral type, false otherwise.
      */
     [[nodiscard]] bool is_integral() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_integral);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_integral);
     }
 
     /**
@@ -1264,7 +1387,7 @@ public:
      * @return True if the underlying type is a signed type, false otherwise.
      */
     [[nodiscard]] bool is_signed() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_signed);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_signed);
     }
 
     /**
@@ -1272,7 +1395,7 @@ public:
      * @return True if the underlying type is an array type, false otherwise.
      */
     [[nodiscard]] bool is_array() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_array);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_array);
     }
 
     /**
@@ -1280,7 +1403,7 @@ public:
      * @return True if the underlying type is an enum, false otherwise.
      */
     [[nodiscard]] bool is_enum() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_enum);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_enum);
     }
 
     /**
@@ -1288,7 +1411,7 @@ public:
      * @return True if the underlying type is a class, false otherwise.
      */
     [[nodiscard]] bool is_class() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_class);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_class);
     }
 
     /**
@@ -1296,7 +1419,7 @@ public:
      * @return True if the underlying type is a pointer, false otherwise.
      */
     [[nodiscard]] bool is_pointer() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_pointer);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_pointer);
     }
 
     /**
@@ -1305,7 +1428,16 @@ public:
      * doesn't refer to a pointer type.
      */
     [[nodiscard]] meta_type remove_pointer() const noexcept {
-        return {*ctx, node.remove_pointer(internal::meta_context::from(*ctx))};
+        return {*ctx, node->remove_pointer(internal::meta_context::from(*ctx))};
+    }
+
+    /**
+     * @brief Checks whether a type is trivially copyable or not.
+     * @return True if the underlying type is trivially copyable, false
+     * otherwise.
+     */
+    [[nodiscard]] bool is_trivially_copyable() const noexcept {
+        return static_cast<bool>(node->traits & internal::meta_traits::is_trivially_copyable);
     }
 
     /**
@@ -1313,7 +1445,7 @@ public:
      * @return True if the underlying type is pointer-like, false otherwise.
      */
     [[nodiscard]] bool is_pointer_like() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_meta_pointer_like);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_meta_pointer_like);
     }
 
     /**
@@ -1321,7 +1453,7 @@ public:
      * @return True if the type is a sequence container, false otherwise.
      */
     [[nodiscard]] bool is_sequence_container() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_meta_sequence_container);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_meta_sequence_container);
     }
 
     /**
@@ -1329,7 +1461,7 @@ public:
      * @return True if the type is an associative container, false otherwise.
      */
     [[nodiscard]] bool is_associative_container() const noexcept {
-        return static_cast<bool>(node.traits & internal::meta_traits::is_meta_associative_container);
+        return static_cast<bool>(node->traits & internal::meta_traits::is_meta_associative_container);
     }
 
     /**
@@ -1339,7 +1471,7 @@ public:
      * false otherwise.
      */
     [[nodiscard]] bool is_template_specialization() const noexcept {
-        return (node.templ.arity != 0u);
+        return (node->templ.arity != 0u);
     }
 
     /**
@@ -1347,7 +1479,7 @@ public:
      * @return The number of template arguments.
      */
     [[nodiscard]] size_type template_arity() const noexcept {
-        return node.templ.arity;
+        return node->templ.arity;
     }
 
     /**
@@ -1355,7 +1487,7 @@ public:
      * @return The tag for the class template of the underlying type.
      */
     [[nodiscard]] inline meta_type template_type() const noexcept {
-        return node.templ.type ? meta_type{*ctx, node.templ.type(internal::meta_context::from(*ctx))} : meta_type{};
+        return node->templ.type ? meta_type{*ctx, node->templ.type(internal::meta_context::from(*ctx))} : meta_type{};
     }
 
     /**
@@ -1364,7 +1496,7 @@ public:
      * @return The type of the i-th template argument of a type.
      */
     [[nodiscard]] inline meta_type template_arg(const size_type index) const noexcept {
-        return index < template_arity() ? meta_type{*ctx, node.templ.arg(internal::meta_context::from(*ctx), index)} : meta_type{};
+        return index < template_arity() ? meta_type{*ctx, node->templ.arg(internal::meta_context::from(*ctx), index)} : meta_type{};
     }
 
     /**
@@ -1374,7 +1506,7 @@ public:
      */
     [[nodiscard]] bool can_cast(const meta_type &other) const noexcept {
         // casting this is UB in all cases but we aren't going to use the resulting pointer, so...
-        return (internal::try_cast(internal::meta_context::from(*ctx), node, other.node, this) != nullptr);
+        return (internal::try_cast(internal::meta_context::from(*ctx), *node, *other.node, this) != nullptr);
     }
 
     /**
@@ -1383,7 +1515,7 @@ public:
      * @return True if the conversion is allowed, false otherwise.
      */
     [[nodiscard]] bool can_convert(const meta_type &other) const noexcept {
-        return (internal::try_convert(internal::meta_context::from(*ctx), node, other.info(), other.is_arithmetic() || other.is_enum(), nullptr, [](const void *, auto &&...args) { return ((static_cast<void>(args), 1) + ... + 0u); }) != 0u);
+        return (internal::try_convert(internal::meta_context::from(*ctx), *node, other.info(), other.is_arithmetic() || other.is_enum(), nullptr, [](const void *, auto &&...args) { return ((static_cast<void>(args), 1) + ... + 0u); }) != 0u);
     }
 
     /**
@@ -1392,7 +1524,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_type, typename decltype(internal::meta_type_descriptor::base)::const_iterator> base() const noexcept {
         using range_type = meta_range<meta_type, typename decltype(internal::meta_type_descriptor::base)::const_iterator>;
-        return node.details ? range_type{{*ctx, node.details->base.cbegin()}, {*ctx, node.details->base.cend()}} : range_type{};
+        return node->details ? range_type{{*ctx, node->details->base.cbegin()}, {*ctx, node->details->base.cend()}} : range_type{};
     }
 
     /**
@@ -1401,7 +1533,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_data, typename decltype(internal::meta_type_descriptor::data)::const_iterator> data() const noexcept {
         using range_type = meta_range<meta_data, typename decltype(internal::meta_type_descriptor::data)::const_iterator>;
-        return node.details ? range_type{{*ctx, node.details->data.cbegin()}, {*ctx, node.details->data.cend()}} : range_type{};
+        return node->details ? range_type{{*ctx, node->details->data.cbegin()}, {*ctx, node->details->data.cend()}} : range_type{};
     }
 
     /**
@@ -1410,7 +1542,7 @@ public:
      * @return The registered meta data for the given identifier, if any.
      */
     [[nodiscard]] meta_data data(const id_type id) const {
-        const auto *elem = internal::look_for<&internal::meta_type_descriptor::data>(internal::meta_context::from(*ctx), node, id);
+        const auto *elem = internal::look_for<&internal::meta_type_descriptor::data>(internal::meta_context::from(*ctx), *node, id);
         return elem ? meta_data{*ctx, *elem} : meta_data{};
     }
 
@@ -1420,7 +1552,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_func, typename decltype(internal::meta_type_descriptor::func)::const_iterator> func() const noexcept {
         using return_type = meta_range<meta_func, typename decltype(internal::meta_type_descriptor::func)::const_iterator>;
-        return node.details ? return_type{{*ctx, node.details->func.cbegin()}, {*ctx, node.details->func.cend()}} : return_type{};
+        return node->details ? return_type{{*ctx, node->details->func.cbegin()}, {*ctx, node->details->func.cend()}} : return_type{};
     }
 
     /**
@@ -1432,7 +1564,7 @@ public:
      * @return The registered meta function for the given identifier, if any.
      */
     [[nodiscard]] meta_func func(const id_type id) const {
-        const auto *elem = internal::look_for<&internal::meta_type_descriptor::func>(internal::meta_context::from(*ctx), node, id);
+        const auto *elem = internal::look_for<&internal::meta_type_descriptor::func>(internal::meta_context::from(*ctx), *node, id);
         return elem ? meta_func{*ctx, *elem} : meta_func{};
     }
 
@@ -1443,14 +1575,14 @@ public:
      * @return A wrapper containing the new instance, if any.
      */
     [[nodiscard]] meta_any construct(meta_any *const args, const size_type sz) const {
-        if(node.details) {
-            if(const auto *candidate = lookup(args, sz, false, [first = node.details->ctor.cbegin(), last = node.details->ctor.cend()]() mutable { return first == last ? nullptr : &(first++)->second; }); candidate) {
+        if(node->details) {
+            if(const auto *candidate = lookup(args, sz, false, [first = node->details->ctor.cbegin(), last = node->details->ctor.cend()]() mutable { return first == last ? nullptr : &(first++)->second; }); candidate) {
                 return candidate->invoke(*ctx, args);
             }
         }
 
-        if(sz == 0u && node.default_constructor) {
-            return node.default_constructor(*ctx);
+        if(sz == 0u && node->default_constructor) {
+            return node->default_constructor(*ctx);
         }
 
         return meta_any{meta_ctx_arg, *ctx};
@@ -1474,12 +1606,12 @@ public:
      * @return A wrapper that references the given instance.
      */
     [[nodiscard]] meta_any from_void(void *elem) const {
-        return (elem && node.from_void) ? node.from_void(*ctx, elem, nullptr) : meta_any{meta_ctx_arg, *ctx};
+        return (elem && node->from_void) ? node->from_void(*ctx, elem, nullptr) : meta_any{meta_ctx_arg, *ctx};
     }
 
     /*! @copydoc from_void */
     [[nodiscard]] meta_any from_void(const void *elem) const {
-        return (elem && node.from_void) ? node.from_void(*ctx, nullptr, elem) : meta_any{meta_ctx_arg, *ctx};
+        return (elem && node->from_void) ? node->from_void(*ctx, nullptr, elem) : meta_any{meta_ctx_arg, *ctx};
     }
 
     /**
@@ -1491,8 +1623,8 @@ public:
      * @return A wrapper containing the returned value, if any.
      */
     meta_any invoke(const id_type id, meta_handle instance, meta_any *const args, const size_type sz) const {
-        if(node.details) {
-            if(auto it = node.details->func.find(id); it != node.details->func.cend()) {
+        if(node->details) {
+            if(auto it = node->details->func.find(id); it != node->details->func.cend()) {
                 if(const auto *candidate = lookup(args, sz, instance && (instance->data() == nullptr), [curr = &it->second]() mutable { return curr ? std::exchange(curr, curr->next.get()) : nullptr; }); candidate) {
                     return candidate->invoke(*ctx, meta_handle{*ctx, std::move(instance)}, args);
                 }
@@ -1554,7 +1686,7 @@ public:
      */
     [[nodiscard]] meta_range<meta_prop, typename decltype(internal::meta_type_descriptor::prop)::const_iterator> prop() const noexcept {
         using range_type = meta_range<meta_prop, typename decltype(internal::meta_type_descriptor::prop)::const_iterator>;
-        return node.details ? range_type{{*ctx, node.details->prop.cbegin()}, {*ctx, node.details->prop.cend()}} : range_type{};
+        return node->details ? range_type{{*ctx, node->details->prop.cbegin()}, {*ctx, node->details->prop.cend()}} : range_type{};
     }
 
     /**
@@ -1563,19 +1695,19 @@ public:
      * @return The registered meta property for the given key, if any.
      */
     [[nodiscard]] meta_prop prop(const id_type key) const {
-        const auto *elem = internal::look_for<&internal::meta_type_descriptor::prop>(internal::meta_context::from(*ctx), node, key);
+        const auto *elem = internal::look_for<&internal::meta_type_descriptor::prop>(internal::meta_context::from(*ctx), *node, key);
         return elem ? meta_prop{*ctx, *elem} : meta_prop{};
     }
 
     /*! @copydoc meta_data::traits */
     template<typename Type>
     [[nodiscard]] Type traits() const noexcept {
-        return internal::meta_to_user_traits<Type>(node.traits);
+        return internal::meta_to_user_traits<Type>(node->traits);
     }
 
     /*! @copydoc meta_data::custom */
     [[nodiscard]] meta_custom custom() const noexcept {
-        return {node.custom};
+        return {node->custom};
     }
 
     /**
@@ -1588,11 +1720,11 @@ public:
 
     /*! @copydoc meta_prop::operator== */
     [[nodiscard]] bool operator==(const meta_type &other) const noexcept {
-        return (ctx == other.ctx) && ((!node.info && !other.node.info) || (node.info && other.node.info && *node.info == *other.node.info));
+        return (ctx == other.ctx) && ((!node->info && !other.node->info) || (node->info && other.node->info && *node->info == *other.node->info));
     }
 
 private:
-    internal::meta_type_node node{};
+    const internal::meta_type_node *node{&internal::meta_null_type_node()};
     const meta_ctx *ctx{};
 };
 
@@ -1607,7 +1739,7 @@ private:
 }
 
 [[nodiscard]] inline meta_type meta_any::type() const noexcept {
-    return node.info ? meta_type{*ctx, node} : meta_type{};
+    return node->info ? meta_type{*ctx, *node} : meta_type{};
 }
 
 template<typename... Args>
@@ -1635,7 +1767,7 @@ bool meta_any::set(const id_type id, Type &&value) {
 }
 
 [[nodiscard]] inline meta_any meta_any::allow_cast(const meta_type &type) const {
-    return internal::try_convert(internal::meta_context::from(*ctx), node, type.info(), type.is_arithmetic() || type.is_enum(), data(), [this, &type]([[maybe_unused]] const void *instance, auto &&...args) {
+    return internal::try_convert(internal::meta_context::from(*ctx), *node, type.info(), type.is_arithmetic() || type.is_enum(), data(), [this, &type]([[maybe_unused]] const void *instance, auto &&...args) {
         if constexpr((std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype(args)>>, internal::meta_type_node> || ...)) {
             return (args.from_void(*ctx, nullptr, instance), ...);
         } else if constexpr((std::is_same_v<std::remove_const_t<std::remove_reference_t<decltype(args)>>, internal::meta_conv_node> || ...)) {
@@ -1644,7 +1776,7 @@ bool meta_any::set(const id_type id, Type &&value) {
             // exploits the fact that arithmetic types and enums are also default constructible
             auto other = type.construct();
             const auto value = (args(nullptr, instance), ...);
-            other.node.conversion_helper(other.data(), &value);
+            other.node->conversion_helper(other.data(), &value);
             return other;
         } else {
             // forwards to force a compile-time error in case of available arguments
@@ -1654,12 +1786,12 @@ bool meta_any::set(const id_type id, Type &&value) {
 }
 
 inline bool meta_any::assign(const meta_any &other) {
-    auto value = other.allow_cast({*ctx, node});
+    auto value = other.allow_cast({*ctx, *node});
     return value && storage.assign(value.storage);
 }
 
 inline bool meta_any::assign(meta_any &&other) {
-    if(*node.info == *other.node.info) {
+    if(*node->info == *other.node->info) {
         return storage.assign(std::move(other.storage));
     }
 
@@ -1901,7 +2033,7 @@ inline bool meta_sequence_container::reserve(const size_type sz) {
  */
 inline meta_sequence_container::iterator meta_sequence_container::insert(const iterator &it, meta_any value) {
     // this abomination is necessary because only on macos value_type and const_reference are different types for std::vector<bool>
-    if(const auto vtype = value_type_node(internal::meta_context::from(*ctx)); !const_only && (value.allow_cast({*ctx, vtype}) || value.allow_cast({*ctx, const_reference_node(internal::meta_context::from(*ctx))}))) {
+    if(const auto &vtype = value_type_node(internal::meta_context::from(*ctx)); !const_only && (value.allow_cast({*ctx, vtype}) || value.allow_cast({*ctx, const_reference_node(internal::meta_context::from(*ctx))}))) {
         const bool is_value_type = (value.type().info() == *vtype.info);
         return insert_fn(*ctx, const_cast<void *>(data), is_value_type ? std::as_const(value).data() : nullptr, is_value_type ? nullptr : std::as_const(value).data(), it);
     }
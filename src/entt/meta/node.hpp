@@ -5,8 +5,8 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "../config/config.h"
-#include "../container/dense_map.hpp"
 #include "../core/attribute.h"
 #include "../core/bit.hpp"
 #include "../core/enum.hpp"
@@ -40,6 +40,7 @@ enum class meta_traits : std::uint32_t {
     is_meta_pointer_like = 0x0200,
     is_meta_sequence_container = 0x0400,
     is_meta_associative_container = 0x0800,
+    is_trivially_copyable = 0x1000,
     _user_defined_traits = 0xFFFF,
     _entt_enum_as_bitmask = 0xFFFF
 };
@@ -60,6 +61,151 @@ template<typename Type>
     return meta_traits{traits << shift};
 }
 
+// elements are kept in order of registration, larger sets also get a hash table
+template<typename Type>
+class meta_flat_map {
+    using container_type = std::vector<std::pair<id_type, Type>>;
+
+    // below the threshold, the index contains the keys and lookups are linear
+    static constexpr std::size_t threshold = 4u;
+
+    [[nodiscard]] std::size_t position(const id_type key) const noexcept {
+        if(elements.size() <= threshold) {
+            for(std::size_t pos{}, last = index.size(); pos < last; ++pos) {
+                if(index[pos] == key) {
+                    return pos;
+                }
+            }
+        } else {
+            const auto mask = index.size() - 1u;
+
+            for(auto slot = static_cast<std::size_t>(key) & mask; index[slot] != id_type{}; slot = (slot + 1u) & mask) {
+                if(const auto pos = static_cast<std::size_t>(index[slot]) - 1u; elements[pos].first == key) {
+                    return pos;
+                }
+            }
+        }
+
+        return elements.size();
+    }
+
+    void insert(const std::size_t pos) {
+        const auto mask = index.size() - 1u;
+        auto slot = static_cast<std::size_t>(elements[pos].first) & mask;
+
+        while(index[slot] != id_type{}) {
+            slot = (slot + 1u) & mask;
+        }
+
+        index[slot] = static_cast<id_type>(pos + 1u);
+    }
+
+    void rehash(const std::size_t count) {
+        index.assign(count, id_type{});
+
+        for(std::size_t pos{}, last = elements.size(); pos < last; ++pos) {
+            insert(pos);
+        }
+    }
+
+    void push(const id_type key, Type value) {
+        elements.emplace_back(key, std::move(value));
+
+        if(const auto length = elements.size(); length <= threshold) {
+            index.push_back(key);
+        } else if(index.size() < (length * 2u)) {
+            // the load factor of the hash table never exceeds one half
+            rehash(next_power_of_two(length * 2u));
+        } else {
+            insert(length - 1u);
+        }
+    }
+
+public:
+    using key_type = id_type;
+    using mapped_type = Type;
+    using size_type = std::size_t;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    [[nodiscard]] const_iterator cbegin() const noexcept {
+        return elements.cbegin();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return cbegin();
+    }
+
+    [[nodiscard]] iterator begin() noexcept {
+        return elements.begin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept {
+        return elements.cend();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept {
+        return cend();
+    }
+
+    [[nodiscard]] iterator end() noexcept {
+        return elements.end();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return elements.empty();
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return elements.size();
+    }
+
+    [[nodiscard]] iterator find(const id_type key) noexcept {
+        return elements.begin() + static_cast<typename iterator::difference_type>(position(key));
+    }
+
+    [[nodiscard]] const_iterator find(const id_type key) const noexcept {
+        return elements.cbegin() + static_cast<typename const_iterator::difference_type>(position(key));
+    }
+
+    [[nodiscard]] bool contains(const id_type key) const noexcept {
+        return (position(key) != elements.size());
+    }
+
+    [[nodiscard]] Type &operator[](const id_type key) {
+        if(const auto pos = position(key); pos != elements.size()) {
+            return elements[pos].second;
+        }
+
+        push(key, Type{});
+        return elements.back().second;
+    }
+
+    std::pair<iterator, bool> insert_or_assign(const id_type key, Type value) {
+        if(const auto pos = position(key); pos != elements.size()) {
+            elements[pos].second = std::move(value);
+            return {elements.begin() + static_cast<typename iterator::difference_type>(pos), false};
+        }
+
+        push(key, std::move(value));
+        return {elements.end() - 1, true};
+    }
+
+    void shrink_to_fit() {
+        elements.shrink_to_fit();
+
+        if(elements.size() > threshold) {
+            rehash(next_power_of_two(elements.size() * 2u));
+        }
+
+        index.shrink_to_fit();
+    }
+
+private:
+    container_type elements{};
+    std::vector<id_type> index{};
+};
+
 struct meta_type_node;
 
 struct meta_custom_node {
@@ -68,12 +214,12 @@ struct meta_custom_node {
 };
 
 struct meta_prop_node {
-    meta_type_node (*type)(const meta_context &) noexcept {};
+    const meta_type_node &(*type)(const meta_context &) noexcept {};
     std::shared_ptr<void> value{};
 };
 
 struct meta_base_node {
-    meta_type_node (*type)(const meta_context &) noexcept {};
+    const meta_type_node &(*type)(const meta_context &) noexcept {};
     const void *(*cast)(const void *) noexcept {};
 };
 
@@ -98,12 +244,15 @@ struct meta_data_node {
 
     meta_traits traits{meta_traits::is_none};
     size_type arity{0u};
-    meta_type_node (*type)(const meta_context &) noexcept {};
+    const meta_type_node &(*type)(const meta_context &) noexcept {};
     meta_type (*arg)(const meta_ctx &, const size_type) noexcept {};
     bool (*set)(meta_handle, meta_any){};
     meta_any (*get)(const meta_ctx &, meta_handle){};
+    const type_info *owner{};
+    meta_any (*bound)(const meta_ctx &, void *, const void *, const void *const *){};
+    const void *(*address)(const void *) noexcept {};
     meta_custom_node custom{};
-    dense_map<id_type, meta_prop_node, identity> prop{};
+    meta_flat_map<meta_prop_node> prop{};
 };
 
 struct meta_func_node {
@@ -111,29 +260,31 @@ struct meta_func_node {
 
     meta_traits traits{meta_traits::is_none};
     size_type arity{0u};
-    meta_type_node (*ret)(const meta_context &) noexcept {};
+    const meta_type_node &(*ret)(const meta_context &) noexcept {};
     meta_type (*arg)(const meta_ctx &, const size_type) noexcept {};
     meta_any (*invoke)(const meta_ctx &, meta_handle, meta_any *const){};
+    const type_info *owner{};
+    meta_any (*bound)(const meta_ctx &, void *, const void *, const void *const *){};
     std::shared_ptr<meta_func_node> next{};
     meta_custom_node custom{};
-    dense_map<id_type, meta_prop_node, identity> prop{};
+    meta_flat_map<meta_prop_node> prop{};
 };
 
 struct meta_template_node {
     using size_type = std::size_t;
 
     size_type arity{0u};
-    meta_type_node (*type)(const meta_context &) noexcept {};
-    meta_type_node (*arg)(const meta_context &, const size_type) noexcept {};
+    const meta_type_node &(*type)(const meta_context &) noexcept {};
+    const meta_type_node &(*arg)(const meta_context &, const size_type) noexcept {};
 };
 
 struct meta_type_descriptor {
-    dense_map<id_type, meta_ctor_node, identity> ctor{};
-    dense_map<id_type, meta_base_node, identity> base{};
-    dense_map<id_type, meta_conv_node, identity> conv{};
-    dense_map<id_type, meta_data_node, identity> data{};
-    dense_map<id_type, meta_func_node, identity> func{};
-    dense_map<id_type, meta_prop_node, identity> prop{};
+    meta_flat_map<meta_ctor_node> ctor{};
+    meta_flat_map<meta_base_node> base{};
+    meta_flat_map<meta_conv_node> conv{};
+    meta_flat_map<meta_data_node> data{};
+    meta_flat_map<meta_func_node> func{};
+    meta_flat_map<meta_prop_node> prop{};
 };
 
 struct meta_type_node {
@@ -143,8 +294,8 @@ struct meta_type_node {
     id_type id{};
     meta_traits traits{meta_traits::is_none};
     size_type size_of{0u};
-    meta_type_node (*resolve)(const meta_context &) noexcept {};
-    meta_type_node (*remove_pointer)(const meta_context &) noexcept {};
+    const meta_type_node &(*resolve)(const meta_context &) noexcept {};
+    const meta_type_node &(*remove_pointer)(const meta_context &) noexcept {};
     meta_any (*default_constructor)(const meta_ctx &){};
     double (*conversion_helper)(void *, const void *){};
     meta_any (*from_void)(const meta_ctx &, void *, const void *){};
@@ -172,27 +323,126 @@ auto *look_for(const meta_context &context, const meta_type_node &node, const id
 }
 
 template<typename Type>
-meta_type_node resolve(const meta_context &) noexcept;
+const meta_type_node &resolve(const meta_context &) noexcept;
 
 template<typename... Args>
-[[nodiscard]] auto meta_arg_node(const meta_context &context, type_list<Args...>, [[maybe_unused]] const std::size_t index) noexcept {
+[[nodiscard]] const meta_type_node &meta_arg_node(const meta_context &context, type_list<Args...>, [[maybe_unused]] const std::size_t index) noexcept {
     [[maybe_unused]] std::size_t pos{};
-    meta_type_node (*value)(const meta_context &) noexcept = nullptr;
+    const meta_type_node &(*value)(const meta_context &) noexcept = nullptr;
     ((value = (pos++ == index ? &resolve<std::remove_cv_t<std::remove_reference_t<Args>>> : value)), ...);
     ENTT_ASSERT(value != nullptr, "Out of bounds");
     return value(context);
 }
 
+inline bool meta_find_path(const meta_context &context, const meta_type_node &from, const id_type to, const bool conv, meta_path_node &path) {
+    if(from.info && from.info->hash() == to) {
+        path.type = &from;
+        return true;
+    }
+
+    if(from.details) {
+        if(const auto it = from.details->conv.find(to); conv && it != from.details->conv.cend()) {
+            path.conv = &it->second;
+            return true;
+        }
+
+        for(auto &&curr: from.details->base) {
+            path.step.push_back(curr.second.cast);
+
+            if(meta_find_path(context, curr.second.type(context), to, conv, path)) {
+                return true;
+            }
+
+            path.step.pop_back();
+        }
+    }
+
+    return false;
+}
+
+// as above, casts are applied on the fly and nothing is allocated
+[[nodiscard]] inline bool meta_walk_path(const meta_context &context, const meta_type_node &from, const id_type to, const bool conv, const void *&instance, const meta_type_node *&type, const meta_conv_node *&func) noexcept {
+    if(from.info && from.info->hash() == to) {
+        type = &from;
+        return true;
+    }
+
+    if(from.details) {
+        if(const auto it = from.details->conv.find(to); conv && it != from.details->conv.cend()) {
+            func = &it->second;
+            return true;
+        }
+
+        for(auto &&curr: from.details->base) {
+            if(const void *other = curr.second.cast(instance); meta_walk_path(context, curr.second.type(context), to, conv, other, type, func)) {
+                instance = other;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// paths are only cached by frozen contexts, see meta_prepare_paths
+[[nodiscard]] inline const meta_path_node *meta_cached_path(const meta_context &context, const meta_type_node &from, const id_type to, const bool conv) noexcept {
+    auto &&cache = conv ? context.conv : context.cast;
+
+    if(const auto it = cache.find(from.info->hash()); it != cache.cend()) {
+        if(const auto other = it->second.find(to); other != it->second.cend()) {
+            return &other->second;
+        }
+    }
+
+    return nullptr;
+}
+
+inline void meta_prepare_path(meta_context &context, const meta_type_node &from, const id_type to, const bool conv) {
+    if(auto &&elem = (conv ? context.conv : context.cast)[from.info->hash()]; !elem.contains(to)) {
+        meta_path_node path{};
+        meta_find_path(context, from, to, conv, path);
+        elem.insert_or_assign(to, std::move(path));
+    }
+}
+
+inline void meta_prepare_paths(meta_context &context, const meta_type_node &from, const meta_type_node &curr) {
+    if(curr.details) {
+        for(auto &&elem: curr.details->conv) {
+            meta_prepare_path(context, from, elem.first, true);
+        }
+
+        for(auto &&elem: curr.details->base) {
+            auto &&other = elem.second.type(context);
+            meta_prepare_path(context, from, other.info->hash(), false);
+            meta_prepare_path(context, from, other.info->hash(), true);
+            meta_prepare_paths(context, from, other);
+        }
+    }
+}
+
+inline void meta_reset_paths(meta_context &context) noexcept {
+    context.cast.clear();
+    context.conv.clear();
+}
+
 [[nodiscard]] inline const void *try_cast(const meta_context &context, const meta_type_node &from, const meta_type_node &to, const void *instance) noexcept {
     if(from.info && to.info && *from.info == *to.info) {
         return instance;
     }
 
-    if(from.details) {
-        for(auto &&curr: from.details->base) {
-            if(const void *elem = try_cast(context, curr.second.type(context), to, curr.second.cast(instance)); elem) {
-                return elem;
+    if(from.details && to.info && !from.details->base.empty()) {
+        if(!context.frozen) {
+            const meta_type_node *type{};
+            const meta_conv_node *func{};
+            return meta_walk_path(context, from, to.info->hash(), false, instance, type, func) ? instance : nullptr;
+        }
+
+        if(const auto *path = meta_cached_path(context, from, to.info->hash(), false); path && path->type) {
+            for(auto *cast: path->step) {
+                instance = cast(instance);
             }
+
+            return instance;
         }
     }
 
@@ -210,9 +460,24 @@ template<typename Func>
             return func(instance, it->second);
         }
 
-        for(auto &&curr: from.details->base) {
-            if(auto other = try_convert(context, curr.second.type(context), to, arithmetic_or_enum, curr.second.cast(instance), func); other) {
-                return other;
+        if(!from.details->base.empty()) {
+            if(!context.frozen) {
+                const meta_type_node *type{};
+                const meta_conv_node *conv{};
+
+                if(meta_walk_path(context, from, to.hash(), true, instance, type, conv)) {
+                    return type ? func(instance, *type) : func(instance, *conv);
+                }
+            } else if(const auto *path = meta_cached_path(context, from, to.hash(), true); path && (path->type || path->conv)) {
+                for(auto *cast: path->step) {
+                    instance = cast(instance);
+                }
+
+                if(path->type) {
+                    return func(instance, *path->type);
+                }
+
+                return func(instance, *path->conv);
             }
         }
     }
@@ -224,19 +489,24 @@ template<typename Func>
     return func(instance);
 }
 
+[[nodiscard]] inline const meta_type_node &meta_null_type_node() noexcept {
+    static const meta_type_node node{};
+    return node;
+}
+
 [[nodiscard]] inline const meta_type_node *try_resolve(const meta_context &context, const type_info &info) noexcept {
     const auto it = context.value.find(info.hash());
-    return it != context.value.end() ? &it->second : nullptr;
+    return it != context.value.end() ? it->second.get() : nullptr;
 }
 
-template<typename Type>
-[[nodiscard]] meta_type_node resolve(const meta_context &context) noexcept {
-    static_assert(std::is_same_v<Type, std::remove_const_t<std::remove_reference_t<Type>>>, "Invalid type");
-
-    if(auto *elem = try_resolve(context, type_id<Type>()); elem) {
-        return *elem;
-    }
+[[nodiscard]] inline const meta_type_node *try_resolve(const meta_context &context, const id_type id) noexcept {
+    const auto other = context.index.find(id);
+    const auto it = context.value.find(other != context.index.cend() ? other->second : id);
+    return (it != context.value.cend() && it->second->id == id) ? it->second.get() : nullptr;
+}
 
+template<typename Type>
+[[nodiscard]] meta_type_node setup_node_for() noexcept {
     meta_type_node node{
         &type_id<Type>(),
         type_id<Type>().hash(),
@@ -249,7 +519,8 @@ template<typename Type>
             | (std::is_pointer_v<Type> ? meta_traits::is_pointer : meta_traits::is_none)
             | (is_meta_pointer_like_v<Type> ? meta_traits::is_meta_pointer_like : meta_traits::is_none)
             | (is_complete_v<meta_sequence_container_traits<Type>> ? meta_traits::is_meta_sequence_container : meta_traits::is_none)
-            | (is_complete_v<meta_associative_container_traits<Type>> ? meta_traits::is_meta_associative_container : meta_traits::is_none),
+            | (is_complete_v<meta_associative_container_traits<Type>> ? meta_traits::is_meta_associative_container : meta_traits::is_none)
+            | (std::is_trivially_copyable_v<Type> ? meta_traits::is_trivially_copyable : meta_traits::is_none),
         size_of_v<Type>,
         &resolve<Type>,
         &resolve<std::remove_cv_t<std::remove_pointer_t<Type>>>};
@@ -284,9 +555,22 @@ template<typename Type>
         node.templ = meta_template_node{
             meta_template_traits<Type>::args_type::size,
             &resolve<typename meta_template_traits<Type>::class_type>,
-            +[](const meta_context &area, const std::size_t index) noexcept { return meta_arg_node(area, typename meta_template_traits<Type>::args_type{}, index); }};
+            +[](const meta_context &area, const std::size_t index) noexcept -> const meta_type_node & { return meta_arg_node(area, typename meta_template_traits<Type>::args_type{}, index); }};
+    }
+
+    return node;
+}
+
+// nodes of types that aren't part of a context are shared by all contexts
+template<typename Type>
+[[nodiscard]] const meta_type_node &resolve(const meta_context &context) noexcept {
+    static_assert(std::is_same_v<Type, std::remove_const_t<std::remove_reference_t<Type>>>, "Invalid type");
+
+    if(auto *elem = try_resolve(context, type_id<Type>()); elem) {
+        return *elem;
     }
 
+    static const meta_type_node node = setup_node_for<Type>();
     return node;
 }
 
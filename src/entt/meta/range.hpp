@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include "../core/fwd.hpp"
 #include "../core/iterator.hpp"
@@ -67,7 +68,11 @@ struct meta_range_iterator final {
     }
 
     [[nodiscard]] constexpr reference operator[](const difference_type value) const noexcept {
-        return {it[value].first, Type{*ctx, it[value].second}};
+        if constexpr(std::is_same_v<It, typename decltype(meta_context::value)::const_iterator>) {
+            return {it[value].first, Type{*ctx, *it[value].second}};
+        } else {
+            return {it[value].first, Type{*ctx, it[value].second}};
+        }
     }
 
     [[nodiscard]] constexpr pointer operator->() const noexcept {
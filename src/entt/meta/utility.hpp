@@ -360,6 +360,65 @@ template<typename Type, typename... Args, std::size_t... Index>
     return meta_any{meta_ctx_arg, ctx};
 }
 
+template<typename Type, auto Candidate, typename Policy, std::size_t... Index>
+[[nodiscard]] auto meta_bound_invoke(std::index_sequence<Index...>) noexcept {
+    using descriptor = meta_function_helper_t<Type, decltype(Candidate)>;
+    meta_any (*func)(const meta_ctx &, void *, const void *, const void *const *) = nullptr;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) - waiting for C++20 (and std::span)
+    if constexpr(std::is_invocable_v<decltype(Candidate), const Type &, type_list_element_t<Index, typename descriptor::args_type>...>) {
+        if constexpr(std::is_invocable_v<decltype(Candidate), const Type &, const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> &...>) {
+            func = +[](const meta_ctx &ctx, void *, const void *instance, [[maybe_unused]] const void *const *args) {
+                return meta_invoke_with_args<Policy>(ctx, Candidate, *static_cast<const Type *>(instance), *static_cast<const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> *>(args[Index])...);
+            };
+        }
+    } else if constexpr(std::is_invocable_v<decltype(Candidate), Type &, type_list_element_t<Index, typename descriptor::args_type>...>) {
+        if constexpr(std::is_invocable_v<decltype(Candidate), Type &, const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> &...>) {
+            func = +[](const meta_ctx &ctx, void *instance, const void *, [[maybe_unused]] const void *const *args) {
+                return meta_invoke_with_args<Policy>(ctx, Candidate, *static_cast<Type *>(instance), *static_cast<const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> *>(args[Index])...);
+            };
+        }
+    } else {
+        if constexpr(std::is_invocable_v<decltype(Candidate), const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> &...>) {
+            func = +[](const meta_ctx &ctx, void *, const void *, [[maybe_unused]] const void *const *args) {
+                return meta_invoke_with_args<Policy>(ctx, Candidate, *static_cast<const std::remove_reference_t<type_list_element_t<Index, typename descriptor::args_type>> *>(args[Index])...);
+            };
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return func;
+}
+
+template<typename Type, auto Data, typename Policy>
+[[nodiscard]] auto meta_bound_getter() noexcept {
+    meta_any (*func)(const meta_ctx &, void *, const void *, const void *const *) = nullptr;
+
+    if constexpr(std::is_member_pointer_v<decltype(Data)> || std::is_function_v<std::remove_reference_t<std::remove_pointer_t<decltype(Data)>>>) {
+        if constexpr(!std::is_array_v<std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<decltype(Data), Type &>>>>) {
+            func = +[](const meta_ctx &ctx, [[maybe_unused]] void *instance, [[maybe_unused]] const void *cinstance, const void *const *) {
+                if constexpr(std::is_invocable_v<decltype(Data), Type &>) {
+                    if(instance) {
+                        return meta_dispatch<Policy>(ctx, std::invoke(Data, *static_cast<Type *>(instance)));
+                    }
+                }
+
+                if constexpr(std::is_invocable_v<decltype(Data), const Type &>) {
+                    return meta_dispatch<Policy>(ctx, std::invoke(Data, *static_cast<const Type *>(cinstance)));
+                } else {
+                    return meta_any{meta_ctx_arg, ctx};
+                }
+            };
+        }
+    } else {
+        func = +[](const meta_ctx &ctx, void *, const void *, const void *const *) {
+            return meta_getter<Type, Data, Policy>(ctx, meta_handle{});
+        };
+    }
+
+    return func;
+}
+
 } // namespace internal
 /*! @endcond */
 
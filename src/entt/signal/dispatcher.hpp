@@ -1,12 +1,17 @@
 #ifndef ENTT_SIGNAL_DISPATCHER_HPP
 #define ENTT_SIGNAL_DISPATCHER_HPP
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <functional>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
@@ -20,12 +25,79 @@ namespace entt {
 /*! @cond TURN_OFF_DOXYGEN */
 namespace internal {
 
+template<typename Type, typename = void>
+struct concurrent_queue: std::false_type {};
+
+template<typename Type>
+struct concurrent_queue<Type, std::enable_if_t<Type::concurrent_queue>>
+    : std::true_type {};
+
+template<typename Traits, typename = void>
+struct event_key {
+    using type = void;
+};
+
+template<typename Traits>
+struct event_key<Traits, std::void_t<decltype(Traits::key(std::declval<const typename Traits::type &>()))>> {
+    using type = std::decay_t<decltype(Traits::key(std::declval<const typename Traits::type &>()))>;
+};
+
+template<typename Traits, typename = void>
+struct event_merge: std::false_type {};
+
+template<typename Traits>
+struct event_merge<Traits, std::void_t<decltype(Traits::merge(std::declval<typename Traits::type &>(), std::declval<typename Traits::type &&>()))>>
+    : std::true_type {};
+
+template<typename Key, typename Allocator>
+struct event_index {
+    using type = dense_map<Key, std::size_t, std::hash<Key>, std::equal_to<>, typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const Key, std::size_t>>>;
+};
+
+template<typename Allocator>
+struct event_index<void, Allocator> {
+    struct type {
+        type(const Allocator &) noexcept {}
+    };
+};
+
+} // namespace internal
+/*! @endcond */
+
+/**
+ * @brief Common way to access various properties of events.
+ *
+ * Specializations can also expose the following functions to coalesce queued
+ * events, if required:
+ *
+ * * A static `key` function that returns the key of a given event. Events
+ *   with the same key are merged at enqueue time.
+ * * An optional static `merge` function that merges an incoming event into
+ *   the pending one. Incoming events replace pending ones otherwise.
+ *
+ * @tparam Type Type of event.
+ */
+template<typename Type, typename = void>
+struct event_traits {
+    static_assert(std::is_same_v<std::decay_t<Type>, Type>, "Unsupported type");
+
+    /*! @brief Event type. */
+    using type = Type;
+
+    /*! @brief Multi-producer queue, default is `false`. */
+    static constexpr bool concurrent_queue = internal::concurrent_queue<Type>::value;
+};
+
+/*! @cond TURN_OFF_DOXYGEN */
+namespace internal {
+
 struct basic_dispatcher_handler {
     virtual ~basic_dispatcher_handler() noexcept = default;
-    virtual void publish() = 0;
+    virtual std::size_t publish(std::size_t) = 0;
     virtual void disconnect(void *) = 0;
     virtual void clear() noexcept = 0;
     [[nodiscard]] virtual std::size_t size() const noexcept = 0;
+    int priority{};
 };
 
 template<typename Type, typename Allocator>
@@ -35,22 +107,93 @@ class dispatcher_handler final: public basic_dispatcher_handler {
     using alloc_traits = std::allocator_traits<Allocator>;
     using signal_type = sigh<void(Type &), Allocator>;
     using container_type = std::vector<Type, typename alloc_traits::template rebind_alloc<Type>>;
+    using traits_type = event_traits<Type>;
+    using key_type = typename event_key<traits_type>::type;
+    using index_type = typename event_index<key_type, Allocator>::type;
+
+    static constexpr bool coalesce = !std::is_void_v<key_type>;
+
+    template<typename... Args>
+    [[nodiscard]] static Type make(Args &&...args) {
+        if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+            return Type{std::forward<Args>(args)...};
+        } else {
+            return Type(std::forward<Args>(args)...);
+        }
+    }
+
+    void push(Type event) {
+        auto key = traits_type::key(std::as_const(event));
+
+        if(const auto it = index.find(key); it != index.end() && it->second >= offset) {
+            if constexpr(event_merge<traits_type>::value) {
+                traits_type::merge(events[it->second], std::move(event));
+            } else {
+                events[it->second] = std::move(event);
+            }
+        } else {
+            events.push_back(std::move(event));
+            index.insert_or_assign(std::move(key), events.size() - 1u);
+        }
+    }
+
+    void reindex() {
+        if constexpr(coalesce) {
+            index.clear();
+
+            for(std::size_t pos{}, last = events.size(); pos < last; ++pos) {
+                index.insert_or_assign(traits_type::key(std::as_const(events[pos])), pos);
+            }
+        }
+    }
+
+    // events enqueued by listeners are left for the next round
+    template<typename Func>
+    std::size_t consume(const std::size_t count, Func func) {
+        const auto length = (std::min)(count, events.size() - offset);
+
+        for(const auto last = offset + length; offset < last;) {
+            func(events[offset++]);
+        }
+
+        if(offset == events.size()) {
+            clear();
+        } else if(offset >= (events.size() - offset)) {
+            events.erase(events.cbegin(), events.cbegin() + static_cast<typename container_type::difference_type>(offset));
+            offset = 0u;
+            reindex();
+        }
+
+        return length;
+    }
 
 public:
     using allocator_type = Allocator;
 
     dispatcher_handler(const allocator_type &allocator)
         : signal{allocator},
-          events{allocator} {}
+          events{allocator},
+          index{allocator},
+          offset{} {}
 
-    void publish() override {
-        const auto length = events.size();
+    std::size_t publish(const std::size_t count) override {
+        return consume(count, [this](Type &event) { signal.publish(event); });
+    }
 
-        for(std::size_t pos{}; pos < length; ++pos) {
-            signal.publish(events[pos]);
-        }
+    template<typename Executor>
+    void publish_parallel(Executor &executor) {
+        // events enqueued by listeners are left for the next round
+        container_type batch{events.get_allocator()};
+        const auto first = static_cast<typename container_type::difference_type>(offset);
+        batch.swap(events);
+        clear();
 
-        events.erase(events.cbegin(), events.cbegin() + length);
+        signal.publish_parallel(executor, batch.begin() + first, batch.end());
+
+        if(events.empty()) {
+            batch.clear();
+            events.swap(batch);
+        }
     }
 
     void disconnect(void *instance) override {
@@ -58,7 +201,12 @@ public:
     }
 
     void clear() noexcept override {
+        if constexpr(coalesce) {
+            index.clear();
+        }
+
         events.clear();
+        offset = 0u;
     }
 
     [[nodiscard]] auto bucket() noexcept {
@@ -71,7 +219,9 @@ public:
 
     template<typename... Args>
     void enqueue(Args &&...args) {
-        if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+        if constexpr(coalesce) {
+            push(make(std::forward<Args>(args)...));
+        } else if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
             events.push_back(Type{std::forward<Args>(args)...});
         } else {
             events.emplace_back(std::forward<Args>(args)...);
@@ -79,12 +229,263 @@ public:
     }
 
     [[nodiscard]] std::size_t size() const noexcept override {
-        return events.size();
+        return events.size() - offset;
     }
 
 private:
     signal_type signal;
     container_type events;
+    index_type index;
+    std::size_t offset;
+};
+
+// intrusive multi-producer single-consumer queue, it never blocks nor allocates
+class mpsc_queue {
+public:
+    struct node_type {
+        std::atomic<node_type *> next{};
+    };
+
+    mpsc_queue() noexcept
+        : stub{},
+          head{&stub},
+          tail{&stub},
+          pending{} {}
+
+    mpsc_queue(const mpsc_queue &) = delete;
+    mpsc_queue(mpsc_queue &&) = delete;
+
+    ~mpsc_queue() noexcept = default;
+
+    mpsc_queue &operator=(const mpsc_queue &) = delete;
+    mpsc_queue &operator=(mpsc_queue &&) = delete;
+
+    void push(node_type *elem) noexcept {
+        pending.fetch_add(1u, std::memory_order_relaxed);
+        tail.exchange(elem, std::memory_order_acq_rel)->next.store(elem, std::memory_order_release);
+    }
+
+    // nodes that are still being pushed are left for the next round
+    // the last consumed node is kept as head and only released on the next round
+    template<typename Consume, typename Release>
+    void drain(Consume consume, Release release) {
+        for(auto *next = head->next.load(std::memory_order_acquire); next; next = head->next.load(std::memory_order_acquire)) {
+            consume(next);
+
+            if(auto *elem = std::exchange(head, next); elem != &stub) {
+                release(elem);
+            }
+
+            pending.fetch_sub(1u, std::memory_order_relaxed);
+        }
+    }
+
+    // no producer must be running meanwhile
+    template<typename Release>
+    void clear(Release release) {
+        drain([](node_type *) {}, release);
+
+        if(head != &stub) {
+            release(std::exchange(head, &stub));
+            stub.next.store(nullptr, std::memory_order_relaxed);
+            tail.store(&stub, std::memory_order_relaxed);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return pending.load(std::memory_order_relaxed);
+    }
+
+private:
+    node_type stub;
+    node_type *head;
+    std::atomic<node_type *> tail;
+    std::atomic<std::size_t> pending;
+};
+
+// bounded multi-consumer free list, it never blocks nor allocates once created
+template<typename Type, std::size_t Size>
+class node_pool {
+    static_assert(Size && ((Size & (Size - 1u)) == 0u), "Size must be a power of two");
+
+    struct cell_type {
+        std::atomic<std::size_t> sequence;
+        Type *value;
+    };
+
+public:
+    node_pool() noexcept
+        : cells{},
+          first{},
+          last{} {
+        for(std::size_t pos{}; pos < Size; ++pos) {
+            cells[pos].sequence.store(pos, std::memory_order_relaxed);
+        }
+    }
+
+    // single producer, that is the thread that drains the queue
+    [[nodiscard]] bool push(Type *value) noexcept {
+        auto &cell = cells[last & (Size - 1u)];
+
+        if(cell.sequence.load(std::memory_order_acquire) != last) {
+            return false;
+        }
+
+        cell.value = value;
+        cell.sequence.store(++last, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] Type *pop() noexcept {
+        for(auto pos = first.load(std::memory_order_relaxed);;) {
+            auto &cell = cells[pos & (Size - 1u)];
+
+            if(const auto sequence = cell.sequence.load(std::memory_order_acquire); sequence == (pos + 1u)) {
+                if(first.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                    auto *value = cell.value;
+                    cell.sequence.store(pos + Size, std::memory_order_release);
+                    return value;
+                }
+            } else if(sequence < (pos + 1u)) {
+                return nullptr;
+            } else {
+                pos = first.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    std::array<cell_type, Size> cells;
+    std::atomic<std::size_t> first;
+    std::size_t last;
+};
+
+template<typename Type, typename Allocator>
+class concurrent_dispatcher_handler final: public basic_dispatcher_handler {
+    using node_base = mpsc_queue::node_type;
+
+    struct node_type: node_base {
+        template<typename... Args>
+        node_type(Args &&...args)
+            : node_base{},
+              value{make(std::forward<Args>(args)...)} {}
+
+        template<typename... Args>
+        [[nodiscard]] static Type make(Args &&...args) {
+            if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+                return Type{std::forward<Args>(args)...};
+            } else {
+                return Type(std::forward<Args>(args)...);
+            }
+        }
+
+        Type value;
+    };
+
+    using alloc_traits = std::allocator_traits<typename std::allocator_traits<Allocator>::template rebind_alloc<node_type>>;
+    using handler_type = dispatcher_handler<Type, Allocator>;
+    using pool_type = node_pool<node_type, ENTT_DISPATCHER_POOL_SIZE>;
+
+    // nodes are returned to the pool and only released once it's full
+    void release(node_base *elem) {
+        auto *node = static_cast<node_type *>(elem);
+        alloc_traits::destroy(allocator, node);
+
+        if(!pool.push(node)) {
+            alloc_traits::deallocate(allocator, node, 1u);
+        }
+    }
+
+    void drain(const bool discard) {
+        const auto consume = [this, discard](node_base *elem) {
+            if(!discard) {
+                handler.enqueue(std::move(static_cast<node_type *>(elem)->value));
+            }
+        };
+
+        queue.drain(consume, [this](node_base *elem) { release(elem); });
+    }
+
+public:
+    using allocator_type = Allocator;
+
+    concurrent_dispatcher_handler(const allocator_type &alloc)
+        : handler{alloc},
+          allocator{alloc},
+          pool{},
+          queue{} {}
+
+    concurrent_dispatcher_handler(const concurrent_dispatcher_handler &) = delete;
+    concurrent_dispatcher_handler(concurrent_dispatcher_handler &&) = delete;
+
+    ~concurrent_dispatcher_handler() noexcept override {
+        queue.clear([this](node_base *elem) { release(elem); });
+
+        for(auto *elem = pool.pop(); elem; elem = pool.pop()) {
+            alloc_traits::deallocate(allocator, elem, 1u);
+        }
+    }
+
+    concurrent_dispatcher_handler &operator=(const concurrent_dispatcher_handler &) = delete;
+    concurrent_dispatcher_handler &operator=(concurrent_dispatcher_handler &&) = delete;
+
+    std::size_t publish(const std::size_t count) override {
+        drain(false);
+        return handler.publish(count);
+    }
+
+    template<typename Executor>
+    void publish_parallel(Executor &executor) {
+        drain(false);
+        handler.publish_parallel(executor);
+    }
+
+    void disconnect(void *instance) override {
+        handler.disconnect(instance);
+    }
+
+    void clear() noexcept override {
+        drain(true);
+        handler.clear();
+    }
+
+    [[nodiscard]] auto bucket() noexcept {
+        return handler.bucket();
+    }
+
+    void trigger(Type event) {
+        handler.trigger(std::move(event));
+    }
+
+    template<typename... Args>
+    void enqueue(Args &&...args) {
+        auto alloc = allocator;
+        auto *elem = pool.pop();
+
+        if(elem == nullptr) {
+            elem = alloc_traits::allocate(alloc, 1u);
+        }
+
+        ENTT_TRY {
+            alloc_traits::construct(alloc, elem, std::forward<Args>(args)...);
+        }
+        ENTT_CATCH {
+            alloc_traits::deallocate(alloc, elem, 1u);
+            ENTT_THROW;
+        }
+
+        queue.push(elem);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept override {
+        return handler.size() + queue.size();
+    }
+
+private:
+    handler_type handler;
+    typename alloc_traits::allocator_type allocator;
+    pool_type pool;
+    mpsc_queue queue;
 };
 
 } // namespace internal
@@ -102,12 +503,22 @@ private:
  * The dispatcher creates instances of the `sigh` class internally. Refer to the
  * documentation of the latter for more details.
  *
+ * Events for which `event_traits<Type>::concurrent_queue` is true are enqueued
+ * in a multi-producer queue instead. Any thread can enqueue them without
+ * waiting, as long as the queue already exists, while updates must happen on
+ * a single thread.
+ *
+ * Queues are updated in order of priority, from the highest to the lowest.
+ * Queues with the same priority are updated in order of creation.<br/>
+ * Queues created by listeners during an update are updated last, while the
+ * order of the queues is restored only once the update is over.
+ *
  * @tparam Allocator Type of allocator used to manage memory and elements.
  */
 template<typename Allocator>
 class basic_dispatcher {
     template<typename Type>
-    using handler_type = internal::dispatcher_handler<Type, Allocator>;
+    using handler_type = std::conditional_t<internal::concurrent_queue<event_traits<Type>>::value, internal::concurrent_dispatcher_handler<Type, Allocator>, internal::dispatcher_handler<Type, Allocator>>;
 
     using key_type = id_type;
     // std::shared_ptr because of its type erased allocator which is useful here
@@ -116,6 +527,28 @@ class basic_dispatcher {
     using alloc_traits = std::allocator_traits<Allocator>;
     using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const key_type, mapped_type>>;
     using container_type = dense_map<key_type, mapped_type, identity, std::equal_to<>, container_allocator>;
+    using order_type = std::vector<internal::basic_dispatcher_handler *, typename alloc_traits::template rebind_alloc<internal::basic_dispatcher_handler *>>;
+
+    [[nodiscard]] static bool compare(const internal::basic_dispatcher_handler *lhs, const internal::basic_dispatcher_handler *rhs) noexcept {
+        return lhs->priority > rhs->priority;
+    }
+
+    // queues created while updating are appended and ranked afterwards
+    void rank(internal::basic_dispatcher_handler *elem) {
+        if(depth == 0u) {
+            order.insert(std::upper_bound(order.begin(), order.end(), elem, &compare), elem);
+        } else {
+            order.push_back(elem);
+            unsorted = true;
+        }
+    }
+
+    void rerank() const {
+        if(depth == 0u && unsorted) {
+            std::stable_sort(order.begin(), order.end(), &compare);
+            unsorted = false;
+        }
+    }
 
     template<typename Type>
     [[nodiscard]] handler_type<Type> &assure(const id_type id) {
@@ -124,7 +557,9 @@ class basic_dispatcher {
 
         if(!ptr) {
             const auto &allocator = get_allocator();
-            ptr = std::allocate_shared<handler_type<Type>>(allocator, allocator);
+            auto elem = std::allocate_shared<handler_type<Type>>(allocator, allocator);
+            rank(elem.get());
+            ptr = std::move(elem);
         }
 
         return static_cast<handler_type<Type> &>(*ptr);
@@ -156,7 +591,10 @@ public:
      * @param allocator The allocator to use.
      */
     explicit basic_dispatcher(const allocator_type &allocator)
-        : pools{allocator, allocator} {}
+        : pools{allocator, allocator},
+          order{allocator},
+          depth{},
+          unsorted{} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     basic_dispatcher(const basic_dispatcher &) = delete;
@@ -166,7 +604,10 @@ public:
      * @param other The instance to move from.
      */
     basic_dispatcher(basic_dispatcher &&other) noexcept
-        : pools{std::move(other.pools)} {}
+        : pools{std::move(other.pools)},
+          order{std::move(other.order)},
+          depth{},
+          unsorted{std::exchange(other.unsorted, false)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -174,7 +615,10 @@ public:
      * @param allocator The allocator to use.
      */
     basic_dispatcher(basic_dispatcher &&other, const allocator_type &allocator)
-        : pools{container_type{std::move(other.pools.first()), allocator}, allocator} {
+        : pools{container_type{std::move(other.pools.first()), allocator}, allocator},
+          order{std::move(other.order), allocator},
+          depth{},
+          unsorted{std::exchange(other.unsorted, false)} {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a dispatcher is not allowed");
     }
 
@@ -195,6 +639,8 @@ public:
     basic_dispatcher &operator=(basic_dispatcher &&other) noexcept {
         ENTT_ASSERT(alloc_traits::is_always_equal::value || get_allocator() == other.get_allocator(), "Copying a dispatcher is not allowed");
         pools = std::move(other.pools);
+        order = std::move(other.order);
+        unsorted = std::exchange(other.unsorted, false);
         return *this;
     }
 
@@ -205,6 +651,8 @@ public:
     void swap(basic_dispatcher &other) {
         using std::swap;
         swap(pools, other.pools);
+        swap(order, other.order);
+        swap(unsorted, other.unsorted);
     }
 
     /**
@@ -215,6 +663,42 @@ public:
         return pools.second();
     }
 
+    /**
+     * @brief Sets the priority of a given queue.
+     *
+     * Queues with a higher priority are updated first. The default priority
+     * of a queue is zero.
+     *
+     * @tparam Type Type of event of the queue.
+     * @param value The priority to assign to the queue.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Type>
+    void prioritize(const int value, const id_type id = type_hash<Type>::value()) {
+        auto &cpool = assure<Type>(id);
+
+        if(depth == 0u) {
+            order.erase(std::find(order.begin(), order.end(), &cpool));
+            cpool.priority = value;
+            rank(&cpool);
+        } else {
+            cpool.priority = value;
+            unsorted = true;
+        }
+    }
+
+    /**
+     * @brief Returns the priority of a given queue.
+     * @tparam Type Type of event of the queue.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return The priority of the given queue.
+     */
+    template<typename Type>
+    [[nodiscard]] int priority(const id_type id = type_hash<Type>::value()) const noexcept {
+        const auto *cpool = assure<std::decay_t<Type>>(id);
+        return cpool ? cpool->priority : 0;
+    }
+
     /**
      * @brief Returns the number of pending events for a given type.
      * @tparam Type Type of event for which to return the count.
@@ -378,18 +862,76 @@ public:
      */
     template<typename Type>
     void update(const id_type id = type_hash<Type>::value()) {
-        assure<Type>(id).publish();
+        assure<Type>(id).publish((std::numeric_limits<size_type>::max)());
+    }
+
+    /**
+     * @brief Delivers all the pending events of a given queue and runs
+     * parallel listeners on an executor.
+     *
+     * Listeners connected as parallel to the sink of the queue are handed to
+     * the executor at once, one task per listener that receives all the events
+     * in order. All the others are invoked afterwards on the calling thread.
+     *
+     * @sa sigh::publish_parallel
+     *
+     * @tparam Type Type of event to send.
+     * @tparam Executor Type of executor to use.
+     * @param executor A valid executor.
+     * @param id Name used to map the event queue within the dispatcher.
+     */
+    template<typename Type, typename Executor>
+    void update_parallel(Executor &&executor, const id_type id = type_hash<Type>::value()) {
+        assure<Type>(id).publish_parallel(executor);
     }
 
     /*! @brief Delivers all the pending events. */
     void update() const {
-        for(auto &&cpool: pools.first()) {
-            cpool.second->publish();
+        update((std::numeric_limits<size_type>::max)());
+    }
+
+    /**
+     * @brief Delivers at most a given number of pending events.
+     *
+     * Queues are drained in order of priority. Events that don't fit the
+     * budget stay in their queues, in the order in which they were enqueued,
+     * and are delivered first on the next update.<br/>
+     * Time budgets are easily built on top of this function, for example:
+     *
+     * @code{.cpp}
+     * while(clock::now() < deadline && dispatcher.update(64u) != 0u) {}
+     * @endcode
+     *
+     * @param count Maximum number of events to deliver.
+     * @return The number of events delivered.
+     */
+    size_type update(const size_type count) const {
+        size_type done{};
+        ++depth;
+
+        ENTT_TRY {
+            // queues created by listeners are appended and updated last
+            for(size_type pos{}; pos < order.size() && done < count; ++pos) {
+                done += order[pos]->publish(count - done);
+            }
+        }
+        ENTT_CATCH {
+            --depth;
+            rerank();
+            ENTT_THROW;
         }
+
+        --depth;
+        rerank();
+        return done;
     }
 
 private:
     compressed_pair<container_type, allocator_type> pools;
+    // listeners can create or prioritize queues while updating
+    mutable order_type order;
+    mutable std::size_t depth;
+    mutable bool unsorted;
 };
 
 } // namespace entt
@@ -1,15 +1,20 @@
 #ifndef ENTT_SIGNAL_EMITTER_HPP
 #define ENTT_SIGNAL_EMITTER_HPP
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
+#include "../config/config.h"
 #include "../container/dense_map.hpp"
 #include "../core/compressed_pair.hpp"
 #include "../core/fwd.hpp"
 #include "../core/type_info.hpp"
 #include "../core/utility.hpp"
 #include "fwd.hpp"
+#include "inplace_delegate.hpp"
 
 namespace entt {
 
@@ -29,17 +34,33 @@ namespace entt {
  * Moreover, whenever an event is published, an emitter also passes a reference
  * to itself to its listeners.
  *
+ * Handlers are stored in a list of slots, one per handled event, and are
+ * looked up through an index of event types filled when listeners are
+ * registered. Listeners are owning delegates, therefore registering a listener
+ * doesn't allocate beyond what the slot requires.
+ *
  * @tparam Derived Emitter type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
  */
 template<typename Derived, typename Allocator>
 class emitter {
-    using key_type = id_type;
-    using mapped_type = std::function<void(void *)>;
+    using handler_type = inplace_delegate<void(void *, Derived &)>;
+
+    struct slot_type {
+        handler_type func;
+        id_type id;
+    };
 
     using alloc_traits = std::allocator_traits<Allocator>;
-    using container_allocator = typename alloc_traits::template rebind_alloc<std::pair<const key_type, mapped_type>>;
-    using container_type = dense_map<key_type, mapped_type, identity, std::equal_to<>, container_allocator>;
+    using index_allocator = typename alloc_traits::template rebind_alloc<std::pair<const id_type, std::size_t>>;
+    using index_type = dense_map<id_type, std::size_t, identity, std::equal_to<>, index_allocator>;
+    using container_type = std::vector<slot_type, typename alloc_traits::template rebind_alloc<slot_type>>;
+
+    template<typename Type>
+    [[nodiscard]] const slot_type *slot() const {
+        const auto it = index.find(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value());
+        return (it == index.cend()) ? nullptr : &slots.first()[it->second];
+    }
 
 public:
     /*! @brief Allocator type. */
@@ -56,7 +77,8 @@ public:
      * @param allocator The allocator to use.
      */
     explicit emitter(const allocator_type &allocator)
-        : handlers{allocator, allocator} {}
+        : index{allocator},
+          slots{container_type{allocator}, allocator} {}
 
     /*! @brief Default copy constructor, deleted on purpose. */
     emitter(const emitter &) = delete;
@@ -66,7 +88,8 @@ public:
      * @param other The instance to move from.
      */
     emitter(emitter &&other) noexcept
-        : handlers{std::move(other.handlers)} {}
+        : index{std::move(other.index)},
+          slots{std::move(other.slots)} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -74,8 +97,9 @@ public:
      * @param allocator The allocator to use.
      */
     emitter(emitter &&other, const allocator_type &allocator)
-        : handlers{container_type{std::move(other.handlers.first()), allocator}, allocator} {
-        ENTT_ASSERT(alloc_traits::is_always_equal::value || handlers.second() == other.handlers.second(), "Copying an emitter is not allowed");
+        : index{std::move(other.index), allocator},
+          slots{container_type{std::move(other.slots.first()), allocator}, allocator} {
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || slots.second() == other.slots.second(), "Copying an emitter is not allowed");
     }
 
     /*! @brief Default destructor. */
@@ -95,8 +119,9 @@ public:
      * @return This emitter.
      */
     emitter &operator=(emitter &&other) noexcept {
-        ENTT_ASSERT(alloc_traits::is_always_equal::value || handlers.second() == other.handlers.second(), "Copying an emitter is not allowed");
-        handlers = std::move(other.handlers);
+        ENTT_ASSERT(alloc_traits::is_always_equal::value || slots.second() == other.slots.second(), "Copying an emitter is not allowed");
+        index = std::move(other.index);
+        slots = std::move(other.slots);
         return *this;
     }
 
@@ -106,7 +131,8 @@ public:
      */
     void swap(emitter &other) {
         using std::swap;
-        swap(handlers, other.handlers);
+        swap(index, other.index);
+        swap(slots, other.slots);
     }
 
     /**
@@ -114,7 +140,7 @@ public:
      * @return The associated allocator.
      */
     [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
-        return handlers.second();
+        return slots.second();
     }
 
     /**
@@ -124,21 +150,43 @@ public:
      */
     template<typename Type>
     void publish(Type &&value) {
-        if(const auto id = type_id<Type>().hash(); handlers.first().contains(id)) {
-            handlers.first()[id](&value);
+        if(const auto *elem = slot<Type>(); elem) {
+            elem->func(&value, static_cast<Derived &>(*this));
         }
     }
 
     /**
      * @brief Registers a listener with the event emitter.
+     *
+     * The listener is stored in an owning delegate. Therefore, it must fit the
+     * buffer of an owning delegate and replaces the previous listener for the
+     * same type of event, if any.
+     *
      * @tparam Type Type of event to which to connect the listener.
+     * @tparam Func Type of listener to register.
      * @param func The listener to register.
      */
-    template<typename Type>
-    void on(std::function<void(Type &, Derived &)> func) {
-        handlers.first().insert_or_assign(type_id<Type>().hash(), [func = std::move(func), this](void *value) {
-            func(*static_cast<Type *>(value), static_cast<Derived &>(*this));
-        });
+    template<typename Type, typename Func>
+    void on(Func func) {
+        static_assert(std::is_invocable_v<Func &, Type &, Derived &>, "Invalid listener");
+
+        handler_type elem{[func = std::move(func)](void *value, Derived &owner) mutable {
+            func(*static_cast<Type *>(value), owner);
+        }};
+
+        if(const auto id = type_hash<std::remove_cv_t<Type>>::value(); index.contains(id)) {
+            slots.first()[index[id]].func = std::move(elem);
+        } else {
+            slots.first().push_back(slot_type{std::move(elem), id});
+
+            ENTT_TRY {
+                index.emplace(id, slots.first().size() - 1u);
+            }
+            ENTT_CATCH {
+                slots.first().pop_back();
+                ENTT_THROW;
+            }
+        }
     }
 
     /**
@@ -147,12 +195,23 @@ public:
      */
     template<typename Type>
     void erase() {
-        handlers.first().erase(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value());
+        if(const auto it = index.find(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value()); it != index.end()) {
+            const auto pos = it->second;
+            index.erase(it);
+
+            if(auto &elem = slots.first(); pos != elem.size() - 1u) {
+                elem[pos] = std::move(elem.back());
+                index[elem[pos].id] = pos;
+            }
+
+            slots.first().pop_back();
+        }
     }
 
     /*! @brief Disconnects all the listeners. */
     void clear() noexcept {
-        handlers.first().clear();
+        index.clear();
+        slots.first().clear();
     }
 
     /**
@@ -162,7 +221,7 @@ public:
      */
     template<typename Type>
     [[nodiscard]] bool contains() const {
-        return handlers.first().contains(type_hash<std::remove_cv_t<std::remove_reference_t<Type>>>::value());
+        return slot<Type>() != nullptr;
     }
 
     /**
@@ -170,11 +229,12 @@ public:
      * @return True if there are no listeners registered, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return handlers.first().empty();
+        return slots.first().empty();
     }
 
 private:
-    compressed_pair<container_type, allocator_type> handlers;
+    index_type index;
+    compressed_pair<container_type, allocator_type> slots;
 };
 
 } // namespace entt
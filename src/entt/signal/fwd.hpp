@@ -1,6 +1,7 @@
 #ifndef ENTT_SIGNAL_FWD_HPP
 #define ENTT_SIGNAL_FWD_HPP
 
+#include <cstddef>
 #include <memory>
 
 namespace entt {
@@ -8,12 +9,18 @@ namespace entt {
 template<typename>
 class delegate;
 
+template<typename, std::size_t = sizeof(void *) * 2u>
+class inplace_delegate;
+
 template<typename = std::allocator<void>>
 class basic_dispatcher;
 
 template<typename, typename = std::allocator<void>>
 class emitter;
 
+template<typename = std::allocator<void>>
+class basic_mailbox;
+
 class connection;
 
 struct scoped_connection;
@@ -27,6 +34,9 @@ class sigh;
 /*! @brief Alias declaration for the most common use case. */
 using dispatcher = basic_dispatcher<>;
 
+/*! @brief Alias declaration for the most common use case. */
+using mailbox = basic_mailbox<>;
+
 /*! @brief Disambiguation tag for constructors and the like. */
 template<auto>
 struct connect_arg_t {
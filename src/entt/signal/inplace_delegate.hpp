@@ -0,0 +1,227 @@
+#ifndef ENTT_SIGNAL_INPLACE_DELEGATE_HPP
+#define ENTT_SIGNAL_INPLACE_DELEGATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../config/config.h"
+#include "delegate.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Basic owning delegate implementation.
+ *
+ * Primary template isn't defined on purpose. All the specializations give a
+ * compile-time error unless the template parameter is a function type.
+ */
+template<typename, std::size_t>
+class inplace_delegate;
+
+/**
+ * @brief Owning delegate with a fixed inline buffer.
+ *
+ * Unlike a delegate, an owning delegate stores a copy of the callable object
+ * it's given, captures included. Callable objects are always stored in the
+ * inline buffer, therefore an owning delegate never allocates memory. Types
+ * that don't fit the buffer are rejected at compile-time.<br/>
+ * Trivially copyable callable objects are relocated with a plain copy of the
+ * buffer when an owning delegate is moved.
+ *
+ * @tparam Ret Return type of a function type.
+ * @tparam Args Types of arguments of a function type.
+ * @tparam Len Size of the inline buffer.
+ */
+template<typename Ret, typename... Args, std::size_t Len>
+class inplace_delegate<Ret(Args...), Len> {
+    enum class operation : std::uint8_t {
+        move,
+        destroy
+    };
+
+    struct storage_type {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        alignas(std::max_align_t) std::byte data[Len + !Len];
+    };
+
+    using function_type = Ret(void *, Args...);
+    using vtable_type = void(const operation, inplace_delegate &, inplace_delegate *);
+
+    template<typename Type>
+    static Ret invoke(void *value, Args... args) {
+        return static_cast<Ret>(std::invoke(*std::launder(static_cast<Type *>(value)), std::forward<Args>(args)...));
+    }
+
+    template<typename Type>
+    static void basic_vtable(const operation op, inplace_delegate &self, inplace_delegate *other) {
+        auto *elem = std::launder(reinterpret_cast<Type *>(&self.storage));
+
+        if(op == operation::move) {
+            ::new(&other->storage) Type(std::move(*elem));
+        }
+
+        elem->~Type();
+    }
+
+    void release() noexcept {
+        if(vtable) {
+            vtable(operation::destroy, *this, nullptr);
+        }
+
+        fn = nullptr;
+        vtable = nullptr;
+    }
+
+    void move_from(inplace_delegate &other) noexcept {
+        if(other.vtable) {
+            other.vtable(operation::move, other, this);
+        } else {
+            std::memcpy(&storage, &other.storage, sizeof(storage));
+        }
+
+        fn = std::exchange(other.fn, nullptr);
+        vtable = std::exchange(other.vtable, nullptr);
+    }
+
+public:
+    /*! @brief Function type of the delegate. */
+    using type = Ret(Args...);
+    /*! @brief Return type of the delegate. */
+    using result_type = Ret;
+
+    /*! @brief Default constructor. */
+    inplace_delegate() noexcept
+        : storage{},
+          fn{},
+          vtable{} {}
+
+    /**
+     * @brief Constructs an owning delegate from a given callable object.
+     * @tparam Type Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Type, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Type>, inplace_delegate>>>
+    inplace_delegate(Type &&func)
+        : inplace_delegate{} {
+        emplace(std::forward<Type>(func));
+    }
+
+    /**
+     * @brief Constructs an owning delegate with a given object or payload, if
+     * any.
+     * @tparam Candidate Function or member to connect to the delegate.
+     * @tparam Type Type of class or type of payload, if any.
+     * @param value_or_instance Optional valid object that fits the purpose.
+     */
+    template<auto Candidate, typename... Type>
+    inplace_delegate(connect_arg_t<Candidate>, Type &&...value_or_instance) noexcept
+        : inplace_delegate{delegate<Ret(Args...)>{connect_arg<Candidate>, std::forward<Type>(value_or_instance)...}} {}
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    inplace_delegate(const inplace_delegate &) = delete;
+
+    /**
+     * @brief Move constructor.
+     * @param other The instance to move from.
+     */
+    inplace_delegate(inplace_delegate &&other) noexcept
+        : inplace_delegate{} {
+        move_from(other);
+    }
+
+    /*! @brief Frees the stored callable object, if any. */
+    ~inplace_delegate() noexcept {
+        release();
+    }
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This owning delegate.
+     */
+    inplace_delegate &operator=(const inplace_delegate &) = delete;
+
+    /**
+     * @brief Move assignment operator.
+     * @param other The instance to move from.
+     * @return This owning delegate.
+     */
+    inplace_delegate &operator=(inplace_delegate &&other) noexcept {
+        if(this != &other) {
+            release();
+            move_from(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the stored callable object with a new one.
+     * @tparam Type Type of callable object.
+     * @param func A valid callable object.
+     */
+    template<typename Type>
+    void emplace(Type &&func) {
+        using value_type = std::decay_t<Type>;
+
+        static_assert(sizeof(value_type) <= Len && alignof(value_type) <= alignof(std::max_align_t), "Callable object too large");
+        static_assert(std::is_nothrow_move_constructible_v<value_type>, "Nothrow move constructible type required");
+        static_assert(std::is_invocable_r_v<Ret, value_type &, Args...>, "Invalid callable object");
+
+        release();
+        ::new(&storage) value_type(std::forward<Type>(func));
+        fn = &invoke<value_type>;
+
+        if constexpr(!std::is_trivially_copyable_v<value_type> || !std::is_trivially_destructible_v<value_type>) {
+            vtable = &basic_vtable<value_type>;
+        }
+    }
+
+    /**
+     * @brief Resets an owning delegate.
+     *
+     * After a reset, an owning delegate cannot be invoked anymore.
+     */
+    void reset() noexcept {
+        release();
+    }
+
+    /**
+     * @brief Triggers an owning delegate.
+     *
+     * The delegate invokes the underlying callable object and returns the
+     * result.
+     *
+     * @warning
+     * Attempting to trigger an invalid delegate results in undefined
+     * behavior.
+     *
+     * @param args Arguments to use to invoke the underlying function.
+     * @return The value returned by the underlying function.
+     */
+    Ret operator()(Args... args) const {
+        ENTT_ASSERT(static_cast<bool>(*this), "Uninitialized delegate");
+        return fn(const_cast<storage_type *>(&storage), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks whether an owning delegate actually stores a listener.
+     * @return False if the delegate is empty, true otherwise.
+     */
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return !(fn == nullptr);
+    }
+
+private:
+    storage_type storage;
+    function_type *fn;
+    vtable_type *vtable;
+};
+
+} // namespace entt
+
+#endif
@@ -0,0 +1,390 @@
+#ifndef ENTT_SIGNAL_MAILBOX_HPP
+#define ENTT_SIGNAL_MAILBOX_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../config/config.h"
+#include "../core/compressed_pair.hpp"
+#include "../core/fwd.hpp"
+#include "../core/type_info.hpp"
+#include "dispatcher.hpp"
+#include "fwd.hpp"
+
+namespace entt {
+
+/**
+ * @brief Basic mailbox implementation.
+ *
+ * A mailbox is a set of dispatchers, one per consumer, each of which with its
+ * own inbox. Any thread can enqueue events for a consumer without waiting,
+ * while the consumer receives them on its own thread when it updates its
+ * dispatcher.<br/>
+ * The number of consumers is set once and for all on construction, so that
+ * producers never have to synchronize with each other or with the consumers.
+ * Nodes of small events are recycled through a bounded pool per consumer, so
+ * that producers don't allocate in the long run.
+ *
+ * Listeners are connected to the dispatcher of a consumer as usual. Refer to
+ * the documentation of the dispatcher for more details.
+ *
+ * @warning
+ * All functions but `enqueue_to` must be invoked on the thread that owns the
+ * given consumer. In particular, listeners are always invoked on the thread
+ * that updates the consumer.
+ *
+ * @tparam Allocator Type of allocator used to manage memory and elements.
+ */
+template<typename Allocator>
+class basic_mailbox {
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using dispatcher_type = basic_dispatcher<Allocator>;
+
+    class inbox_type;
+
+    struct node_base: internal::mpsc_queue::node_type {
+        // events are moved to the target dispatcher, if any, and released otherwise
+        void (*deliver)(node_base *, dispatcher_type *, inbox_type &){};
+    };
+
+    template<typename Type>
+    struct node_type: node_base {
+        template<typename... Args>
+        node_type(Args &&...args)
+            : node_base{},
+              value{make(std::forward<Args>(args)...)} {
+            this->deliver = &basic_mailbox::deliver<Type>;
+        }
+
+        template<typename... Args>
+        [[nodiscard]] static Type make(Args &&...args) {
+            if constexpr(std::is_aggregate_v<Type> && (sizeof...(Args) != 0u || !std::is_default_constructible_v<Type>)) {
+                return Type{std::forward<Args>(args)...};
+            } else {
+                return Type(std::forward<Args>(args)...);
+            }
+        }
+
+        Type value;
+    };
+
+    // nodes of small events share the same size and are recycled regardless of their type
+    struct block_type {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        alignas(std::max_align_t) std::byte data[64u];
+    };
+
+    template<typename Type>
+    static constexpr bool is_pooled_v = (sizeof(node_type<Type>) <= sizeof(block_type)) && (alignof(node_type<Type>) <= alignof(block_type));
+
+    template<typename Type>
+    using node_traits = typename alloc_traits::template rebind_traits<node_type<Type>>;
+    using block_traits = typename alloc_traits::template rebind_traits<block_type>;
+
+    template<typename Type>
+    static void deliver(node_base *elem, dispatcher_type *target, inbox_type &owner) {
+        auto *node = static_cast<node_type<Type> *>(elem);
+
+        if(target) {
+            target->enqueue(std::move(node->value));
+        } else {
+            owner.template release<Type>(node);
+        }
+    }
+
+    class inbox_type {
+        using queue_node = internal::mpsc_queue::node_type;
+        using pool_type = internal::node_pool<block_type, ENTT_DISPATCHER_POOL_SIZE>;
+
+        void release(queue_node *elem) {
+            static_cast<node_base *>(elem)->deliver(static_cast<node_base *>(elem), nullptr, *this);
+        }
+
+    public:
+        inbox_type(const Allocator &allocator)
+            : dispatcher{allocator},
+              pool{},
+              queue{} {}
+
+        inbox_type(const inbox_type &) = delete;
+        inbox_type(inbox_type &&) = delete;
+
+        ~inbox_type() noexcept {
+            typename block_traits::allocator_type allocator{dispatcher.get_allocator()};
+            queue.clear([this](queue_node *elem) { release(elem); });
+
+            for(auto *elem = pool.pop(); elem; elem = pool.pop()) {
+                block_traits::deallocate(allocator, elem, 1u);
+            }
+        }
+
+        inbox_type &operator=(const inbox_type &) = delete;
+        inbox_type &operator=(inbox_type &&) = delete;
+
+        // producers only fall back to the allocator when the pool is empty
+        template<typename Type, typename... Args>
+        void push(Args &&...args) {
+            if constexpr(is_pooled_v<Type>) {
+                typename block_traits::allocator_type allocator{dispatcher.get_allocator()};
+                auto *elem = pool.pop();
+
+                if(elem == nullptr) {
+                    elem = block_traits::allocate(allocator, 1u);
+                }
+
+                ENTT_TRY {
+                    queue.push(::new(static_cast<void *>(elem)) node_type<Type>(std::forward<Args>(args)...));
+                }
+                ENTT_CATCH {
+                    block_traits::deallocate(allocator, elem, 1u);
+                    ENTT_THROW;
+                }
+            } else {
+                typename node_traits<Type>::allocator_type allocator{dispatcher.get_allocator()};
+                auto *elem = node_traits<Type>::allocate(allocator, 1u);
+
+                ENTT_TRY {
+                    node_traits<Type>::construct(allocator, elem, std::forward<Args>(args)...);
+                }
+                ENTT_CATCH {
+                    node_traits<Type>::deallocate(allocator, elem, 1u);
+                    ENTT_THROW;
+                }
+
+                queue.push(elem);
+            }
+        }
+
+        // nodes are returned to the pool and only released once it's full
+        template<typename Type>
+        void release(node_type<Type> *elem) {
+            if constexpr(is_pooled_v<Type>) {
+                std::destroy_at(elem);
+
+                if(auto *block = static_cast<block_type *>(static_cast<void *>(elem)); !pool.push(block)) {
+                    typename block_traits::allocator_type allocator{dispatcher.get_allocator()};
+                    block_traits::deallocate(allocator, block, 1u);
+                }
+            } else {
+                typename node_traits<Type>::allocator_type allocator{dispatcher.get_allocator()};
+                node_traits<Type>::destroy(allocator, elem);
+                node_traits<Type>::deallocate(allocator, elem, 1u);
+            }
+        }
+
+        void drain(const bool discard) {
+            const auto consume = [this, discard](queue_node *elem) {
+                if(!discard) {
+                    static_cast<node_base *>(elem)->deliver(static_cast<node_base *>(elem), &dispatcher, *this);
+                }
+            };
+
+            queue.drain(consume, [this](queue_node *elem) { release(elem); });
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return dispatcher.size() + queue.size();
+        }
+
+        dispatcher_type dispatcher;
+
+    private:
+        pool_type pool;
+        internal::mpsc_queue queue;
+    };
+
+    // std::shared_ptr because of its type erased allocator which is useful here
+    using container_type = std::vector<std::shared_ptr<inbox_type>, typename alloc_traits::template rebind_alloc<std::shared_ptr<inbox_type>>>;
+
+    [[nodiscard]] inbox_type &inbox(const std::size_t consumer) const {
+        ENTT_ASSERT(consumer < inboxes.first().size(), "Invalid consumer");
+        return *inboxes.first()[consumer];
+    }
+
+    template<typename Type, typename... Args>
+    void push(const std::size_t consumer, Args &&...args) {
+        inbox(consumer).template push<Type>(std::forward<Args>(args)...);
+    }
+
+public:
+    /*! @brief Allocator type. */
+    using allocator_type = Allocator;
+    /*! @brief Unsigned integer type. */
+    using size_type = std::size_t;
+
+    /**
+     * @brief Constructs a mailbox with a given number of consumers.
+     * @param count Number of consumers of the mailbox.
+     */
+    explicit basic_mailbox(const size_type count)
+        : basic_mailbox{count, allocator_type{}} {}
+
+    /**
+     * @brief Constructs a mailbox with a given number of consumers and a given
+     * allocator.
+     * @param count Number of consumers of the mailbox.
+     * @param allocator The allocator to use.
+     */
+    basic_mailbox(const size_type count, const allocator_type &allocator)
+        : inboxes{allocator, allocator} {
+        inboxes.first().reserve(count);
+
+        for(size_type pos{}; pos < count; ++pos) {
+            inboxes.first().push_back(std::allocate_shared<inbox_type>(allocator, allocator));
+        }
+    }
+
+    /*! @brief Default copy constructor, deleted on purpose. */
+    basic_mailbox(const basic_mailbox &) = delete;
+
+    /*! @brief Default move constructor. */
+    basic_mailbox(basic_mailbox &&) noexcept = default;
+
+    /*! @brief Default destructor. */
+    ~basic_mailbox() noexcept = default;
+
+    /**
+     * @brief Default copy assignment operator, deleted on purpose.
+     * @return This mailbox.
+     */
+    basic_mailbox &operator=(const basic_mailbox &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     * @return This mailbox.
+     */
+    basic_mailbox &operator=(basic_mailbox &&) noexcept = default;
+
+    /**
+     * @brief Returns the associated allocator.
+     * @return The associated allocator.
+     */
+    [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+        return inboxes.second();
+    }
+
+    /**
+     * @brief Returns the number of consumers of a mailbox.
+     * @return The number of consumers of the mailbox.
+     */
+    [[nodiscard]] size_type consumers() const noexcept {
+        return inboxes.first().size();
+    }
+
+    /**
+     * @brief Returns the dispatcher of a given consumer.
+     * @param consumer A valid consumer identifier.
+     * @return The dispatcher of the given consumer.
+     */
+    [[nodiscard]] dispatcher_type &operator[](const size_type consumer) noexcept {
+        return inbox(consumer).dispatcher;
+    }
+
+    /**
+     * @brief Returns the number of pending events of a given consumer.
+     *
+     * Events enqueued concurrently by other threads may or may not be counted.
+     *
+     * @param consumer A valid consumer identifier.
+     * @return The number of pending events of the given consumer.
+     */
+    [[nodiscard]] size_type size(const size_type consumer) const noexcept {
+        return inbox(consumer).size();
+    }
+
+    /**
+     * @brief Returns a sink object for the given event and consumer.
+     * @sa basic_dispatcher::sink
+     * @tparam Type Type of event of which to get the sink.
+     * @param consumer A valid consumer identifier.
+     * @param id Name used to map the event queue within the dispatcher.
+     * @return A temporary sink object.
+     */
+    template<typename Type>
+    [[nodiscard]] auto sink(const size_type consumer, const id_type id = type_hash<Type>::value()) {
+        return inbox(consumer).dispatcher.template sink<Type>(id);
+    }
+
+    /**
+     * @brief Triggers an immediate event of a given type for a consumer.
+     * @tparam Type Type of event to trigger.
+     * @param consumer A valid consumer identifier.
+     * @param value An instance of the given type of event.
+     */
+    template<typename Type>
+    void trigger(const size_type consumer, Type &&value = {}) {
+        inbox(consumer).dispatcher.trigger(std::forward<Type>(value));
+    }
+
+    /**
+     * @brief Enqueues an event of the given type for a consumer.
+     *
+     * This function can be invoked from any thread.
+     *
+     * @tparam Type Type of event to enqueue.
+     * @tparam Args Types of arguments to use to construct the event.
+     * @param consumer A valid consumer identifier.
+     * @param args Arguments to use to construct the event.
+     */
+    template<typename Type, typename... Args>
+    void enqueue_to(const size_type consumer, Args &&...args) {
+        push<Type>(consumer, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Enqueues an event of the given type for a consumer.
+     *
+     * This function can be invoked from any thread.
+     *
+     * @tparam Type Type of event to enqueue.
+     * @param consumer A valid consumer identifier.
+     * @param value An instance of the given type of event.
+     */
+    template<typename Type>
+    void enqueue_to(const size_type consumer, Type &&value) {
+        push<std::decay_t<Type>>(consumer, std::forward<Type>(value));
+    }
+
+    /**
+     * @brief Discards all the events queued so far for a consumer.
+     * @param consumer A valid consumer identifier.
+     */
+    void clear(const size_type consumer) {
+        auto &elem = inbox(consumer);
+        elem.drain(true);
+        elem.dispatcher.clear();
+    }
+
+    /**
+     * @brief Delivers all the pending events of a consumer.
+     * @param consumer A valid consumer identifier.
+     */
+    void update(const size_type consumer) {
+        auto &elem = inbox(consumer);
+        elem.drain(false);
+        elem.dispatcher.update();
+    }
+
+    /**
+     * @brief Delivers at most a given number of pending events of a consumer.
+     * @sa basic_dispatcher::update
+     * @param consumer A valid consumer identifier.
+     * @param count Maximum number of events to deliver.
+     * @return The number of events delivered.
+     */
+    size_type update(const size_type consumer, const size_type count) {
+        auto &elem = inbox(consumer);
+        elem.drain(false);
+        return elem.dispatcher.update(count);
+    }
+
+private:
+    compressed_pair<container_type, allocator_type> inboxes;
+};
+
+} // namespace entt
+
+#endif
@@ -1,13 +1,18 @@
 #ifndef ENTT_SIGNAL_SIGH_HPP
 #define ENTT_SIGNAL_SIGH_HPP
 
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
+#include "../config/config.h"
+#include "../core/memory.hpp"
 #include "delegate.hpp"
 #include "fwd.hpp"
+#include "inplace_delegate.hpp"
 
 namespace entt {
 
@@ -46,6 +51,18 @@ class sigh;
  * * Creating signals to use later to notify a bunch of listeners.
  * * Collecting results from a set of functions like in a voting system.
  *
+ * Listeners disconnected while a signal is being published are no longer
+ * invoked but their slots are only released once the signal is modified
+ * outside of a publish. Listeners connected while a signal is being published
+ * are invoked starting from the next publish.<br/>
+ * Publishing only updates an atomic counter to track reentrancy. Therefore, a
+ * signal can be published from multiple threads at once, as long as no
+ * listener is connected or disconnected meanwhile.
+ *
+ * Callable objects of owning listeners are stored aside, at stable addresses,
+ * so that listeners can be connected to a signal while it's being published.
+ * They aren't copied along with a signal, since owning delegates are move-only.
+ *
  * @tparam Ret Return type of a function type.
  * @tparam Args Types of arguments of a function type.
  * @tparam Allocator Type of allocator used to manage memory and elements.
@@ -56,7 +73,188 @@ class sigh<Ret(Args...), Allocator> {
 
     using alloc_traits = std::allocator_traits<Allocator>;
     using delegate_type = delegate<Ret(Args...)>;
-    using container_type = std::vector<delegate_type, typename alloc_traits::template rebind_alloc<delegate_type>>;
+    using owned_allocator_type = typename alloc_traits::template rebind_alloc<inplace_delegate<Ret(Args...)>>;
+    using owned_type = std::unique_ptr<inplace_delegate<Ret(Args...)>, allocation_deleter<owned_allocator_type>>;
+
+    struct listener_type {
+        delegate_type func;
+        std::size_t handle;
+        // position in the list of parallel listeners, if any
+        std::size_t task;
+    };
+
+    struct handle_type {
+        // position of the listener or next free handle
+        std::size_t pos;
+        std::size_t version;
+    };
+
+    using container_type = std::vector<listener_type, typename alloc_traits::template rebind_alloc<listener_type>>;
+    using handle_container_type = std::vector<handle_type, typename alloc_traits::template rebind_alloc<handle_type>>;
+    using task_container_type = std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
+    using owned_container_type = std::vector<owned_type, typename alloc_traits::template rebind_alloc<owned_type>>;
+
+    static constexpr auto invalid = (std::numeric_limits<std::size_t>::max)();
+
+    [[nodiscard]] std::size_t find(const delegate_type &elem) const noexcept {
+        for(auto pos = owned.size() - retired; elem && pos; --pos) {
+            if(to_address(owned[pos - 1u].get()) == elem.data()) {
+                return pos - 1u;
+            }
+        }
+
+        return invalid;
+    }
+
+    // owning listeners of the source aren't copied, their handles are released
+    void detach(const sigh &other) {
+        for(auto pos = calls.size(); pos; --pos) {
+            if(other.find(calls[pos - 1u].func) != invalid) {
+                pop(pos - 1u);
+            }
+        }
+
+        compact();
+    }
+
+    template<typename Func>
+    [[nodiscard]] std::size_t push(Func func, const bool parallel) {
+        auto elem = free_list;
+
+        if(elem == invalid) {
+            elem = handles.size();
+            handles.push_back(handle_type{calls.size(), 0u});
+        } else {
+            free_list = std::exchange(handles[elem].pos, calls.size());
+        }
+
+        ENTT_TRY {
+            if(parallel) {
+                tasks.push_back(calls.size());
+            }
+
+            calls.push_back(listener_type{func, elem, parallel ? (tasks.size() - 1u) : invalid});
+        }
+        ENTT_CATCH {
+            // positions of other listeners never reach the size of the list
+            if(parallel && !tasks.empty() && tasks.back() == calls.size()) {
+                tasks.pop_back();
+            }
+
+            handles[elem].pos = std::exchange(free_list, elem);
+            ENTT_THROW;
+        }
+
+        return elem;
+    }
+
+    [[nodiscard]] std::size_t push(inplace_delegate<Ret(Args...)> func) {
+        const auto pos = owned.size() - retired;
+        owned_allocator_type allocator{owned.get_allocator()};
+        owned.insert(owned.begin() + static_cast<typename owned_container_type::difference_type>(pos), allocate_unique<inplace_delegate<Ret(Args...)>>(allocator, std::move(func)));
+
+        ENTT_TRY {
+            delegate_type call{};
+            call.template connect<&inplace_delegate<Ret(Args...)>::operator()>(*owned[pos]);
+            return push(call, false);
+        }
+        ENTT_CATCH {
+            owned.erase(owned.begin() + static_cast<typename owned_container_type::difference_type>(pos));
+            ENTT_THROW;
+        }
+    }
+
+    void pop(const std::size_t pos) {
+        const auto elem = calls[pos].handle;
+        ++handles[elem].version;
+        handles[elem].pos = std::exchange(free_list, elem);
+
+        // callables that are running are destroyed only after the publish
+        if(const auto curr = find(calls[pos].func); curr != invalid) {
+            const auto last = owned.size() - retired - 1u;
+            owned[curr].swap(owned[last]);
+
+            if(depth.load(std::memory_order_relaxed) == 0u) {
+                owned.erase(owned.begin() + static_cast<typename owned_container_type::difference_type>(last));
+            } else {
+                ++retired;
+            }
+        }
+
+        if(depth.load(std::memory_order_relaxed) == 0u) {
+            if(const auto task = calls[pos].task; task != invalid) {
+                if(const auto other = tasks.back(); other != pos) {
+                    tasks[task] = other;
+                    calls[other].task = task;
+                }
+
+                tasks.pop_back();
+            }
+
+            if(const auto last = calls.size() - 1u; pos != last) {
+                calls[pos] = std::move(calls[last]);
+                handles[calls[pos].handle].pos = pos;
+
+                if(const auto task = calls[pos].task; task != invalid) {
+                    tasks[task] = pos;
+                }
+            }
+
+            calls.pop_back();
+        } else {
+            calls[pos].func.reset();
+            ++holes;
+        }
+    }
+
+    void compact() {
+        if(depth.load(std::memory_order_relaxed) == 0u && holes != 0u) {
+            std::size_t next{};
+            // parallel listeners only decrease, no allocation is involved
+            tasks.clear();
+
+            for(std::size_t pos{}, last = calls.size(); pos < last; ++pos) {
+                if(calls[pos].func) {
+                    if(next != pos) {
+                        calls[next] = std::move(calls[pos]);
+                    }
+
+                    handles[calls[next].handle].pos = next;
+
+                    if(auto &task = calls[next].task; task != invalid) {
+                        task = tasks.size();
+                        tasks.push_back(next);
+                    }
+
+                    ++next;
+                }
+            }
+
+            calls.erase(calls.begin() + static_cast<typename container_type::difference_type>(next), calls.end());
+            owned.erase(owned.end() - static_cast<typename owned_container_type::difference_type>(retired), owned.end());
+            holes = 0u;
+            retired = 0u;
+        }
+    }
+
+    template<typename Func>
+    void invoke(Func func) const {
+        depth.fetch_add(1u, std::memory_order_relaxed);
+
+        ENTT_TRY {
+            for(auto pos = calls.size(); pos; --pos) {
+                if(const auto &elem = calls[pos - 1u].func; elem && func(elem)) {
+                    break;
+                }
+            }
+        }
+        ENTT_CATCH {
+            depth.fetch_sub(1u, std::memory_order_relaxed);
+            ENTT_THROW;
+        }
+
+        depth.fetch_sub(1u, std::memory_order_relaxed);
+    }
 
 public:
     /*! @brief Allocator type. */
@@ -65,6 +263,8 @@ public:
     using size_type = std::size_t;
     /*! @brief Sink type. */
     using sink_type = sink<sigh<Ret(Args...), Allocator>>;
+    /*! @brief Owning delegate type accepted by sinks. */
+    using owning_delegate_type = inplace_delegate<Ret(Args...)>;
 
     /*! @brief Default constructor. */
     sigh() noexcept(std::is_nothrow_default_constructible_v<allocator_type> && std::is_nothrow_constructible_v<container_type, const allocator_type &>)
@@ -75,14 +275,30 @@ public:
      * @param allocator The allocator to use.
      */
     explicit sigh(const allocator_type &allocator) noexcept(std::is_nothrow_constructible_v<container_type, const allocator_type &>)
-        : calls{allocator} {}
+        : calls{allocator},
+          handles{allocator},
+          tasks{allocator},
+          owned{allocator},
+          free_list{invalid},
+          holes{},
+          retired{},
+          depth{} {}
 
     /**
      * @brief Copy constructor.
      * @param other The instance to copy from.
      */
     sigh(const sigh &other) noexcept(std::is_nothrow_copy_constructible_v<container_type>)
-        : calls{other.calls} {}
+        : calls{other.calls},
+          handles{other.handles},
+          tasks{other.tasks},
+          owned{other.owned.get_allocator()},
+          free_list{other.free_list},
+          holes{other.holes},
+          retired{},
+          depth{} {
+        detach(other);
+    }
 
     /**
      * @brief Allocator-extended copy constructor.
@@ -90,14 +306,30 @@ public:
      * @param allocator The allocator to use.
      */
     sigh(const sigh &other, const allocator_type &allocator) noexcept(std::is_nothrow_constructible_v<container_type, const container_type &, const allocator_type &>)
-        : calls{other.calls, allocator} {}
+        : calls{other.calls, allocator},
+          handles{other.handles, allocator},
+          tasks{other.tasks, allocator},
+          owned{allocator},
+          free_list{other.free_list},
+          holes{other.holes},
+          retired{},
+          depth{} {
+        detach(other);
+    }
 
     /**
      * @brief Move constructor.
      * @param other The instance to move from.
      */
     sigh(sigh &&other) noexcept(std::is_nothrow_move_constructible_v<container_type>)
-        : calls{std::move(other.calls)} {}
+        : calls{std::move(other.calls)},
+          handles{std::move(other.handles)},
+          tasks{std::move(other.tasks)},
+          owned{std::move(other.owned)},
+          free_list{std::exchange(other.free_list, invalid)},
+          holes{std::exchange(other.holes, 0u)},
+          retired{std::exchange(other.retired, 0u)},
+          depth{} {}
 
     /**
      * @brief Allocator-extended move constructor.
@@ -105,7 +337,14 @@ public:
      * @param allocator The allocator to use.
      */
     sigh(sigh &&other, const allocator_type &allocator) noexcept(std::is_nothrow_constructible_v<container_type, container_type &&, const allocator_type &>)
-        : calls{std::move(other.calls), allocator} {}
+        : calls{std::move(other.calls), allocator},
+          handles{std::move(other.handles), allocator},
+          tasks{std::move(other.tasks), allocator},
+          owned{std::move(other.owned), allocator},
+          free_list{std::exchange(other.free_list, invalid)},
+          holes{std::exchange(other.holes, 0u)},
+          retired{std::exchange(other.retired, 0u)},
+          depth{} {}
 
     /*! @brief Default destructor. */
     ~sigh() noexcept = default;
@@ -116,7 +355,17 @@ public:
      * @return This signal handler.
      */
     sigh &operator=(const sigh &other) noexcept(std::is_nothrow_copy_assignable_v<container_type>) {
-        calls = other.calls;
+        if(this != &other) {
+            calls = other.calls;
+            handles = other.handles;
+            tasks = other.tasks;
+            owned.clear();
+            free_list = other.free_list;
+            holes = other.holes;
+            retired = 0u;
+            detach(other);
+        }
+
         return *this;
     }
 
@@ -127,6 +376,12 @@ public:
      */
     sigh &operator=(sigh &&other) noexcept(std::is_nothrow_move_assignable_v<container_type>) {
         calls = std::move(other.calls);
+        handles = std::move(other.handles);
+        tasks = std::move(other.tasks);
+        owned = std::move(other.owned);
+        free_list = std::exchange(other.free_list, invalid);
+        holes = std::exchange(other.holes, 0u);
+        retired = std::exchange(other.retired, 0u);
         return *this;
     }
 
@@ -137,6 +392,12 @@ public:
     void swap(sigh &other) noexcept(std::is_nothrow_swappable_v<container_type>) {
         using std::swap;
         swap(calls, other.calls);
+        swap(handles, other.handles);
+        swap(tasks, other.tasks);
+        swap(owned, other.owned);
+        swap(free_list, other.free_list);
+        swap(holes, other.holes);
+        swap(retired, other.retired);
     }
 
     /**
@@ -152,7 +413,7 @@ public:
      * @return Number of listeners currently connected.
      */
     [[nodiscard]] size_type size() const noexcept {
-        return calls.size();
+        return calls.size() - holes;
     }
 
     /**
@@ -160,7 +421,7 @@ public:
      * @return True if the signal has no listeners connected, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return calls.empty();
+        return calls.size() == holes;
     }
 
     /**
@@ -171,9 +432,109 @@ public:
      * @param args Arguments to use to invoke listeners.
      */
     void publish(Args... args) const {
-        for(auto pos = calls.size(); pos; --pos) {
-            calls[pos - 1u](args...);
+        invoke([&args...](const auto &elem) {
+            elem(args...);
+            return false;
+        });
+    }
+
+    /**
+     * @brief Triggers a signal and runs parallel listeners on an executor.
+     *
+     * Listeners connected as parallel are handed to the executor, one task per
+     * listener, while all the others are invoked afterwards on the calling
+     * thread, as with a regular publish.<br/>
+     * The executor is invoked once with a number of tasks and a function
+     * object that accepts the index of a task. It must run all the tasks,
+     * possibly in parallel, and return only once all of them are completed:
+     *
+     * @code{.cpp}
+     * void(std::size_t count, Task task);
+     * @endcode
+     *
+     * The executor isn't invoked at all if there are no parallel listeners.
+     *
+     * @warning
+     * Listeners must not connect nor disconnect other listeners while the
+     * signal is being published in parallel.
+     *
+     * @tparam Executor Type of executor to use.
+     * @param executor A valid executor.
+     * @param args Arguments to use to invoke listeners.
+     */
+    template<typename Executor>
+    void publish_parallel(Executor &&executor, Args... args) const {
+        depth.fetch_add(1u, std::memory_order_relaxed);
+
+        ENTT_TRY {
+            if(!tasks.empty()) {
+                std::forward<Executor>(executor)(tasks.size(), [this, &args...](const std::size_t pos) {
+                    if(const auto &elem = calls[tasks[pos]]; elem.func) {
+                        elem.func(args...);
+                    }
+                });
+            }
+
+            for(auto pos = calls.size(); pos; --pos) {
+                if(const auto &elem = calls[pos - 1u]; elem.task == invalid && elem.func) {
+                    elem.func(args...);
+                }
+            }
         }
+        ENTT_CATCH {
+            depth.fetch_sub(1u, std::memory_order_relaxed);
+            ENTT_THROW;
+        }
+
+        depth.fetch_sub(1u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Triggers a signal once for each element of a range and runs
+     * parallel listeners on an executor.
+     *
+     * The executor is invoked only once for the whole range. Each parallel
+     * listener is a task that receives all the elements in order, so that a
+     * listener never runs concurrently with itself. All the other listeners
+     * are invoked afterwards on the calling thread, element by element.
+     *
+     * @sa publish_parallel
+     *
+     * @tparam Executor Type of executor to use.
+     * @tparam It Type of forward iterator.
+     * @param executor A valid executor.
+     * @param first An iterator to the first element of the range.
+     * @param last An iterator past the last element of the range.
+     */
+    template<typename Executor, typename It, std::size_t Len = sizeof...(Args), typename = std::enable_if_t<Len == 1u>>
+    void publish_parallel(Executor &&executor, It first, It last) const {
+        depth.fetch_add(1u, std::memory_order_relaxed);
+
+        ENTT_TRY {
+            if(!tasks.empty() && first != last) {
+                std::forward<Executor>(executor)(tasks.size(), [this, first, last](const std::size_t pos) {
+                    if(const auto &elem = calls[tasks[pos]]; elem.func) {
+                        for(auto it = first; it != last; ++it) {
+                            elem.func(*it);
+                        }
+                    }
+                });
+            }
+
+            for(; first != last; ++first) {
+                for(auto pos = calls.size(); pos; --pos) {
+                    if(const auto &elem = calls[pos - 1u]; elem.task == invalid && elem.func) {
+                        elem.func(*first);
+                    }
+                }
+            }
+        }
+        ENTT_CATCH {
+            depth.fetch_sub(1u, std::memory_order_relaxed);
+            ENTT_THROW;
+        }
+
+        depth.fetch_sub(1u, std::memory_order_relaxed);
     }
 
     /**
@@ -192,31 +553,38 @@ public:
      */
     template<typename Func>
     void collect(Func func, Args... args) const {
-        for(auto pos = calls.size(); pos; --pos) {
+        invoke([&func, &args...](const auto &elem) {
             if constexpr(std::is_void_v<Ret> || !std::is_invocable_v<Func, Ret>) {
-                calls[pos - 1u](args...);
+                elem(args...);
 
                 if constexpr(std::is_invocable_r_v<bool, Func>) {
-                    if(func()) {
-                        break;
-                    }
+                    return static_cast<bool>(func());
                 } else {
                     func();
+                    return false;
                 }
             } else {
                 if constexpr(std::is_invocable_r_v<bool, Func, Ret>) {
-                    if(func(calls[pos - 1u](args...))) {
-                        break;
-                    }
+                    return static_cast<bool>(func(elem(args...)));
                 } else {
-                    func(calls[pos - 1u](args...));
+                    func(elem(args...));
+                    return false;
                 }
             }
-        }
+        });
     }
 
 private:
     container_type calls;
+    handle_container_type handles;
+    task_container_type tasks;
+    // live callables first, those released while publishing at the end
+    owned_container_type owned;
+    std::size_t free_list;
+    std::size_t holes;
+    std::size_t retired;
+    // publishing is const and reentrant, concurrent publishers are fine too
+    mutable std::atomic<std::size_t> depth;
 };
 
 /**
@@ -230,34 +598,45 @@ class connection {
     template<typename>
     friend class sink;
 
-    connection(delegate<void(void *)> fn, void *ref)
-        : disconnect{fn}, signal{ref} {}
+    connection(void (*fn)(void *, std::size_t, std::size_t), void *ref, const std::size_t elem, const std::size_t ver)
+        : disconnect{fn},
+          signal{ref},
+          handle{elem},
+          version{ver} {}
 
 public:
     /*! @brief Default constructor. */
     connection()
         : disconnect{},
-          signal{} {}
+          signal{},
+          handle{},
+          version{} {}
 
     /**
      * @brief Checks whether a connection is properly initialized.
      * @return True if the connection is properly initialized, false otherwise.
      */
     [[nodiscard]] explicit operator bool() const noexcept {
-        return static_cast<bool>(disconnect);
+        return (disconnect != nullptr);
     }
 
-    /*! @brief Breaks the connection. */
+    /**
+     * @brief Breaks the connection.
+     *
+     * Releasing a connection whose listener was already disconnected in some
+     * other way has no effect.
+     */
     void release() {
         if(disconnect) {
-            disconnect(signal);
-            disconnect.reset();
+            std::exchange(disconnect, nullptr)(signal, handle, version);
         }
     }
 
 private:
-    delegate<void(void *)> disconnect;
+    void (*disconnect)(void *, std::size_t, std::size_t);
     void *signal;
+    std::size_t handle;
+    std::size_t version;
 };
 
 /**
@@ -363,24 +742,34 @@ class sink<sigh<Ret(Args...), Allocator>> {
     using delegate_type = typename signal_type::delegate_type;
     using difference_type = typename signal_type::container_type::difference_type;
 
-    template<auto Candidate, typename Type>
-    static void release(Type value_or_instance, void *signal) {
-        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>(value_or_instance);
+    static void release(void *ref, const std::size_t elem, const std::size_t version) {
+        auto &curr = *static_cast<signal_type *>(ref);
+
+        if(elem < curr.handles.size() && curr.handles[elem].version == version) {
+            curr.pop(curr.handles[elem].pos);
+            curr.compact();
+        }
     }
 
-    template<auto Candidate>
-    static void release(void *signal) {
-        sink{*static_cast<signal_type *>(signal)}.disconnect<Candidate>();
+    template<auto Candidate, typename... Type>
+    connection connect_with(const bool parallel, Type &...value_or_instance) {
+        disconnect<Candidate>(value_or_instance...);
+
+        delegate_type call{};
+        call.template connect<Candidate>(value_or_instance...);
+        const auto elem = signal->push(call, parallel);
+        return {&release, signal, elem, signal->handles[elem].version};
     }
 
     template<typename Func>
     void disconnect_if(Func callback) {
         for(auto pos = signal->calls.size(); pos; --pos) {
-            if(auto &elem = signal->calls[pos - 1u]; callback(elem)) {
-                elem = std::move(signal->calls.back());
-                signal->calls.pop_back();
+            if(const auto &elem = signal->calls[pos - 1u].func; elem && callback(elem)) {
+                signal->pop(pos - 1u);
             }
         }
+
+        signal->compact();
     }
 
 public:
@@ -396,7 +785,7 @@ public:
      * @return True if the sink has no listeners connected, false otherwise.
      */
     [[nodiscard]] bool empty() const noexcept {
-        return signal->calls.empty();
+        return signal->empty();
     }
 
     /**
@@ -409,15 +798,42 @@ public:
      */
     template<auto Candidate, typename... Type>
     connection connect(Type &&...value_or_instance) {
-        disconnect<Candidate>(value_or_instance...);
+        return connect_with<Candidate>(false, value_or_instance...);
+    }
 
-        delegate_type call{};
-        call.template connect<Candidate>(value_or_instance...);
-        signal->calls.push_back(std::move(call));
+    /**
+     * @brief Connects an owning delegate to a signal.
+     *
+     * The callable object is moved in the signal, therefore it doesn't have to
+     * outlive the connection. Owning listeners are disconnected by means of
+     * their connection objects or all together.
+     *
+     * @param func A valid owning delegate.
+     * @return A properly initialized connection object.
+     */
+    connection connect(typename signal_type::owning_delegate_type func) {
+        ENTT_ASSERT(static_cast<bool>(func), "Uninitialized delegate");
+        const auto elem = signal->push(std::move(func));
+        return {&release, signal, elem, signal->handles[elem].version};
+    }
 
-        delegate<void(void *)> conn{};
-        conn.template connect<&release<Candidate, Type...>>(value_or_instance...);
-        return {conn, signal};
+    /**
+     * @brief Connects a thread safe listener to a signal.
+     *
+     * Listeners connected this way are invoked in parallel when the signal is
+     * published by means of `publish_parallel`. Otherwise, they behave like
+     * any other listener.
+     *
+     * @sa connect
+     *
+     * @tparam Candidate Function or member to connect to the signal.
+     * @tparam Type Type of class or type of payload, if any.
+     * @param value_or_instance A valid object that fits the purpose, if any.
+     * @return A properly initialized connection object.
+     */
+    template<auto Candidate, typename... Type>
+    connection connect_parallel(Type &&...value_or_instance) {
+        return connect_with<Candidate>(true, value_or_instance...);
     }
 
     /**
@@ -446,7 +862,7 @@ public:
 
     /*! @brief Disconnects all the listeners from a signal. */
     void disconnect() {
-        signal->calls.clear();
+        disconnect_if([](const auto &) { return true; });
     }
 
 private:
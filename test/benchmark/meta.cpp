@@ -0,0 +1,310 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/core/type_info.hpp>
+#include <entt/meta/context.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include <entt/meta/resolve.hpp>
+
+template<std::size_t>
+struct reflected {
+    [[nodiscard]] int sum(int lhs, int rhs) const {
+        return value + lhs + rhs;
+    }
+
+    int value;
+};
+
+template<std::size_t Depth>
+struct layer: layer<Depth - 1u> {
+    int value;
+};
+
+template<>
+struct layer<0u> {
+    [[nodiscard]] operator int() const {
+        return 0;
+    }
+
+    int value;
+};
+
+template<typename Func>
+void measure(const char *label, const std::size_t count, Func func) {
+    const auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout << label << ": " << (elapsed / static_cast<double>(count)) << " ns/op" << std::endl;
+}
+
+template<std::size_t... Index>
+void meta_with(std::index_sequence<Index...>) {
+    constexpr std::size_t rounds = 100u;
+    constexpr std::size_t count = sizeof...(Index) * rounds;
+    const std::array<const entt::type_info *, sizeof...(Index)> info{&entt::type_id<reflected<Index>>()...};
+    std::vector<entt::id_type> id{};
+    entt::meta_ctx ctx{};
+    std::size_t found{};
+
+    for(std::size_t pos{}; pos < sizeof...(Index); ++pos) {
+        id.push_back(entt::hashed_string::value(("reflected_" + std::to_string(pos)).c_str()));
+    }
+
+    (entt::meta<reflected<Index>>(ctx).type(id[Index]), ...);
+
+    std::cout << sizeof...(Index) << " types" << std::endl;
+
+    measure("resolve by id", count, [&]() {
+        for(std::size_t next{}; next < rounds; ++next) {
+            for(auto &&elem: id) {
+                found += static_cast<bool>(entt::resolve(ctx, elem));
+            }
+        }
+    });
+
+    measure("resolve by type info", count, [&]() {
+        for(std::size_t next{}; next < rounds; ++next) {
+            for(auto &&elem: info) {
+                found += static_cast<bool>(entt::resolve(ctx, *elem));
+            }
+        }
+    });
+
+    measure("iterate", count, [&]() {
+        for(std::size_t next{}; next < rounds; ++next) {
+            for(auto &&elem: entt::resolve(ctx)) {
+                found += static_cast<bool>(elem.second);
+            }
+        }
+    });
+
+    entt::meta_freeze(ctx);
+
+    measure("resolve by id (frozen)", count, [&]() {
+        for(std::size_t next{}; next < rounds; ++next) {
+            for(auto &&elem: id) {
+                found += static_cast<bool>(entt::resolve(ctx, elem));
+            }
+        }
+    });
+
+    ASSERT_EQ(found, 4u * count);
+}
+
+TEST(Benchmark, Type) {
+    using namespace entt::literals;
+
+    constexpr std::size_t count = 1000000u;
+    entt::meta_ctx ctx{};
+    std::size_t found{};
+
+    entt::meta<reflected<0u>>(ctx).type("reflected"_hs).data<&reflected<0u>::value>("value"_hs);
+
+    const entt::meta_any any{ctx, reflected<0u>{}};
+    const auto data = entt::resolve<reflected<0u>>(ctx).data("value"_hs);
+
+    measure("meta_any::type", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            found += static_cast<bool>(any.type());
+        }
+    });
+
+    measure("meta_data::type", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            found += static_cast<bool>(data.type());
+        }
+    });
+
+    ASSERT_EQ(found, 2u * count);
+}
+
+TEST(Benchmark, Any) {
+    using namespace entt::literals;
+
+    constexpr std::size_t count = 1000000u;
+    entt::meta_ctx ctx{};
+    reflected<0u> instance{1};
+    int sum{};
+
+    entt::meta<reflected<0u>>(ctx).type("reflected"_hs);
+
+    const entt::meta_any value{ctx, instance};
+
+    measure("meta_any (value)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            const entt::meta_any any{ctx, instance};
+            sum += static_cast<int>(any.data() != nullptr);
+        }
+    });
+
+    measure("meta_any (reference)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            const auto any = entt::forward_as_meta(ctx, instance);
+            sum += static_cast<int>(any.data() != nullptr);
+        }
+    });
+
+    measure("meta_any (copy)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            const entt::meta_any any{value};
+            sum += static_cast<int>(any.data() != nullptr);
+        }
+    });
+
+    measure("meta_any (move)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            entt::meta_any any{value};
+            const entt::meta_any other{std::move(any)};
+            sum += static_cast<int>(other.data() != nullptr);
+        }
+    });
+
+    measure("meta_any::cast", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += value.cast<const reflected<0u> &>().value;
+        }
+    });
+
+    ASSERT_EQ(sum, static_cast<int>(5u * count));
+}
+
+TEST(Benchmark, Invoke) {
+    using namespace entt::literals;
+
+    constexpr std::size_t count = 1000000u;
+    entt::meta_ctx ctx{};
+    const reflected<0u> instance{1};
+    int sum{};
+
+    entt::meta<reflected<0u>>(ctx).type("reflected"_hs).data<&reflected<0u>::value>("value"_hs).func<&reflected<0u>::sum>("sum"_hs);
+
+    const auto type = entt::resolve<reflected<0u>>(ctx);
+    const auto func = type.func("sum"_hs);
+    const auto data = type.data("value"_hs);
+    const auto bound = func.bind<const reflected<0u>, int, int>();
+    const auto getter = data.bind<const reflected<0u>>();
+
+    measure("meta_type::invoke", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += type.invoke("sum"_hs, instance, 1, 2).cast<int>();
+        }
+    });
+
+    measure("meta_func::invoke", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += func.invoke(instance, 1, 2).cast<int>();
+        }
+    });
+
+    measure("meta_invoker (function)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += bound(&instance, 1, 2).cast<int>();
+        }
+    });
+
+    measure("meta_data::get", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += data.get(instance).cast<int>();
+        }
+    });
+
+    measure("meta_invoker (data)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += getter(&instance).cast<int>();
+        }
+    });
+
+    ASSERT_EQ(sum, static_cast<int>(3u * 4u * count + 2u * count));
+}
+
+template<std::size_t Size>
+void lookup_with(const std::size_t count) {
+    entt::meta_ctx ctx{};
+    std::vector<entt::id_type> id{};
+    auto factory = entt::meta<reflected<Size>>(ctx);
+    std::size_t found{};
+
+    for(std::size_t pos{}; pos < Size; ++pos) {
+        id.push_back(entt::hashed_string::value(("member_" + std::to_string(pos)).c_str()));
+        factory.template data<&reflected<Size>::value>(id.back()).template func<&reflected<Size>::sum>(id.back());
+    }
+
+    const auto type = entt::resolve<reflected<Size>>(ctx);
+
+    std::cout << Size << " members" << std::endl;
+
+    measure("meta_type::data", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            found += static_cast<bool>(type.data(id[pos % Size]));
+        }
+    });
+
+    measure("meta_type::func", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            found += static_cast<bool>(type.func(id[pos % Size]));
+        }
+    });
+
+    ASSERT_EQ(found, 2u * count);
+}
+
+TEST(Benchmark, Lookup) {
+    constexpr std::size_t count = 1000000u;
+
+    lookup_with<1u>(count);
+    lookup_with<8u>(count);
+    lookup_with<64u>(count);
+}
+
+template<std::size_t... Index>
+void cast_with(entt::meta_ctx &ctx, std::index_sequence<Index...>) {
+    (entt::meta<layer<Index + 1u>>(ctx).template base<layer<Index>>(), ...);
+    entt::meta<layer<0u>>(ctx).conv<int>();
+}
+
+TEST(Benchmark, Cast) {
+    constexpr std::size_t count = 1000000u;
+    entt::meta_ctx ctx{};
+    layer<4u> instance{};
+    std::size_t found{};
+
+    cast_with(ctx, std::make_index_sequence<4u>{});
+
+    const auto any = entt::forward_as_meta(ctx, instance);
+
+    for(const auto frozen: {false, true}) {
+        if(frozen) {
+            entt::meta_freeze(ctx);
+            std::cout << "frozen context" << std::endl;
+        }
+
+        measure("meta_any::try_cast", count, [&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                found += (any.try_cast<layer<0u>>() != nullptr);
+            }
+        });
+
+        measure("meta_any::allow_cast", count, [&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                found += static_cast<bool>(any.allow_cast<int>());
+            }
+        });
+    }
+
+    ASSERT_EQ(found, 4u * count);
+}
+
+TEST(Benchmark, Resolve) {
+    meta_with(std::make_index_sequence<16u>{});
+    meta_with(std::make_index_sequence<256u>{});
+    meta_with(std::make_index_sequence<2048u>{});
+}
@@ -0,0 +1,330 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/entity/registry.hpp>
+#include <entt/signal/delegate.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/emitter.hpp>
+#include <entt/signal/inplace_delegate.hpp>
+#include <entt/signal/mailbox.hpp>
+#include <entt/signal/sigh.hpp>
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static std::atomic<std::size_t> allocations{};
+
+void *operator new(std::size_t size) {
+    allocations.fetch_add(1u, std::memory_order_relaxed);
+
+    if(void *ptr = std::malloc(size == 0u ? 1u : size); ptr) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+template<std::size_t Size>
+struct payload {
+    std::array<std::byte, Size> data;
+};
+
+struct message {
+    std::uint64_t value;
+};
+
+struct concurrent_payload {
+    static constexpr auto concurrent_queue = true;
+    std::uint64_t value;
+};
+
+template<auto>
+struct event {
+    std::uint64_t value;
+};
+
+struct listener {
+    void receive(std::uint64_t value) {
+        sum += value;
+    }
+
+    template<typename Type>
+    void on(const Type &) {
+        ++sum;
+    }
+
+    std::uint64_t sum{};
+};
+
+struct benchmark_emitter: entt::emitter<benchmark_emitter> {};
+
+template<typename Func>
+void measure(const char *label, const std::size_t count, Func func) {
+    const auto from = allocations.load(std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+
+    func();
+
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const auto allocs = allocations.load(std::memory_order_relaxed) - from;
+
+    std::cout << label << ": " << (elapsed / static_cast<double>(count)) << " ns/op, " << (static_cast<double>(allocs) / static_cast<double>(count)) << " allocs/op" << std::endl;
+}
+
+std::uint64_t free_function(std::uint64_t value) {
+    return value + 1u;
+}
+
+TEST(Benchmark, Delegate) {
+    constexpr std::size_t count = 1000000u;
+    listener instance{};
+    std::uint64_t sum{};
+
+    const entt::delegate<std::uint64_t(std::uint64_t)> func{entt::connect_arg<&free_function>};
+    const entt::delegate<void(std::uint64_t)> member{entt::connect_arg<&listener::receive>, instance};
+    const entt::inplace_delegate<std::uint64_t(std::uint64_t)> closure{[&sum](std::uint64_t value) { return sum + value; }};
+
+    measure("delegate (free function)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum += func(pos);
+        }
+    });
+
+    measure("delegate (member function)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            member(pos);
+        }
+    });
+
+    measure("inplace_delegate (closure)", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            sum = closure(pos);
+        }
+    });
+
+    ASSERT_NE(sum + instance.sum, 0u);
+}
+
+TEST(Benchmark, SighPublish) {
+    constexpr std::size_t count = 100000u;
+
+    for(const std::size_t length: {1u, 16u, 256u}) {
+        std::vector<listener> instances(length);
+        entt::sigh<void(std::uint64_t)> sigh{};
+        entt::sink sink{sigh};
+
+        for(auto &&elem: instances) {
+            sink.connect<&listener::receive>(elem);
+        }
+
+        std::cout << length << " listeners" << std::endl;
+
+        measure("sigh::publish", count, [&]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                sigh.publish(pos);
+            }
+        });
+
+        ASSERT_EQ(instances[0u].sum, (count * (count - 1u)) / 2u);
+    }
+}
+
+TEST(Benchmark, SighConnectRelease) {
+    constexpr std::size_t count = 10000u;
+    std::vector<listener> instances(count);
+    std::vector<entt::connection> conn{};
+    entt::sigh<void(std::uint64_t)> sigh{};
+    entt::sink sink{sigh};
+
+    conn.reserve(count);
+
+    measure("sink::connect", count, [&]() {
+        for(auto &&elem: instances) {
+            conn.push_back(sink.connect<&listener::receive>(elem));
+        }
+    });
+
+    measure("connection::release", count, [&]() {
+        for(auto &&elem: conn) {
+            elem.release();
+        }
+    });
+
+    ASSERT_TRUE(sigh.empty());
+}
+
+TEST(Benchmark, StorageMixin) {
+    constexpr std::size_t count = 100000u;
+    entt::registry registry{};
+    std::vector<entt::entity> entity(count);
+    listener instance{};
+
+    registry.create(entity.begin(), entity.end());
+
+    measure("emplace (no listeners)", count, [&]() {
+        for(const auto entt: entity) {
+            registry.emplace<payload<8u>>(entt);
+        }
+    });
+
+    registry.clear<payload<8u>>();
+    registry.on_construct<payload<8u>>().connect<&listener::on<entt::entity>>(instance);
+
+    measure("emplace (one listener)", count, [&]() {
+        for(const auto entt: entity) {
+            registry.emplace<payload<8u>>(entt);
+        }
+    });
+
+    registry.clear<payload<8u>>();
+
+    measure("insert (one listener)", count, [&]() {
+        registry.insert<payload<8u>>(entity.begin(), entity.end());
+    });
+
+    ASSERT_EQ(instance.sum, 2u * count);
+}
+
+template<std::size_t Size>
+void dispatcher_with(const std::size_t count) {
+    entt::dispatcher dispatcher{};
+    listener instance{};
+
+    dispatcher.sink<payload<Size>>().template connect<&listener::on<payload<Size>>>(instance);
+
+    std::cout << Size << " bytes of payload" << std::endl;
+
+    measure("dispatcher::enqueue", count, [&]() {
+        for(std::size_t pos{}; pos < count; ++pos) {
+            dispatcher.enqueue<payload<Size>>();
+        }
+    });
+
+    measure("dispatcher::update", count, [&]() {
+        dispatcher.update();
+    });
+
+    ASSERT_EQ(instance.sum, count);
+}
+
+TEST(Benchmark, Dispatcher) {
+    constexpr std::size_t count = 100000u;
+
+    dispatcher_with<8u>(count);
+    dispatcher_with<64u>(count);
+    dispatcher_with<256u>(count);
+}
+
+TEST(Benchmark, ConcurrentDispatcher) {
+    constexpr std::size_t count = 100000u;
+
+    for(const std::size_t length: {1u, 2u, 4u}) {
+        entt::dispatcher dispatcher{};
+        listener instance{};
+
+        dispatcher.sink<concurrent_payload>().connect<&listener::on<concurrent_payload>>(instance);
+
+        std::cout << length << " producers" << std::endl;
+
+        measure("dispatcher::enqueue (concurrent)", count, [&]() {
+            std::vector<std::thread> producers{};
+
+            for(std::size_t next{}; next < length; ++next) {
+                producers.emplace_back([&dispatcher, per_thread = count / length]() {
+                    for(std::size_t pos{}; pos < per_thread; ++pos) {
+                        dispatcher.enqueue<concurrent_payload>(pos);
+                    }
+                });
+            }
+
+            for(auto &&elem: producers) {
+                elem.join();
+            }
+        });
+
+        measure("dispatcher::update (concurrent)", count, [&]() {
+            dispatcher.update();
+        });
+
+        ASSERT_EQ(instance.sum, (count / length) * length);
+    }
+}
+
+TEST(Benchmark, Mailbox) {
+    constexpr std::size_t count = 100000u;
+
+    for(const std::size_t length: {1u, 2u, 4u}) {
+        entt::mailbox mailbox{length};
+        std::vector<listener> instances(length);
+        std::vector<std::thread> consumers{};
+
+        for(std::size_t pos{}; pos < length; ++pos) {
+            mailbox.sink<message>(pos).connect<&listener::on<message>>(instances[pos]);
+        }
+
+        std::cout << length << " consumers" << std::endl;
+
+        // each consumer sends events to the next one while draining its own inbox
+        measure("mailbox::enqueue_to/update", count, [&]() {
+            for(std::size_t pos{}; pos < length; ++pos) {
+                consumers.emplace_back([&mailbox, &elem = instances[pos], next = (pos + 1u) % length, pos, per_thread = count / length]() {
+                    for(std::size_t curr{}; curr < per_thread; ++curr) {
+                        mailbox.enqueue_to<message>(next, curr);
+                    }
+
+                    while(elem.sum < per_thread) {
+                        mailbox.update(pos);
+                    }
+                });
+            }
+
+            for(auto &&elem: consumers) {
+                elem.join();
+            }
+        });
+
+        for(auto &&elem: instances) {
+            ASSERT_EQ(elem.sum, count / length);
+        }
+    }
+}
+
+template<std::size_t... Index>
+void emitter_with(std::index_sequence<Index...>) {
+    constexpr std::size_t count = 1000000u;
+    benchmark_emitter emitter{};
+    listener instance{};
+
+    (emitter.on<event<Index>>([&instance](auto &elem, auto &) { instance.receive(elem.value); }), ...);
+
+    std::cout << sizeof...(Index) << " event types" << std::endl;
+
+    measure("emitter::publish", count, [&]() {
+        for(std::size_t pos{}; pos < count / sizeof...(Index); ++pos) {
+            (emitter.publish(event<Index>{1u}), ...);
+        }
+    });
+
+    ASSERT_EQ(instance.sum, (count / sizeof...(Index)) * sizeof...(Index));
+}
+
+TEST(Benchmark, Emitter) {
+    emitter_with(std::make_index_sequence<1u>{});
+    emitter_with(std::make_index_sequence<8u>{});
+    emitter_with(std::make_index_sequence<64u>{});
+}
@@ -773,6 +773,42 @@ TEST(Any, SBODestruction) {
     ASSERT_EQ(counter, 6);
 }
 
+TEST(Any, SBOTrivialType) {
+    using tracker_type = tracker<0u>;
+
+    int counter{};
+    entt::any any{test::aggregate{2}};
+    entt::any other{any};
+
+    ASSERT_NE(any.data(), other.data());
+    ASSERT_EQ(any.data(), &entt::any_cast<test::aggregate &>(any));
+    ASSERT_EQ(entt::any_cast<test::aggregate>(other), test::aggregate{2});
+
+    other = tracker_type{counter};
+    other = any;
+
+    ASSERT_EQ(counter, 2);
+    ASSERT_EQ(other.type(), entt::type_id<test::aggregate>());
+    ASSERT_EQ(entt::any_cast<test::aggregate>(other), test::aggregate{2});
+
+    entt::any ref{other.as_ref()};
+    entt::any moved{std::move(ref)};
+
+    ASSERT_EQ(moved.policy(), entt::any_policy::ref);
+    ASSERT_EQ(moved.data(), other.data());
+
+    any = std::as_const(moved);
+    other = std::move(any);
+
+    ASSERT_EQ(other.policy(), entt::any_policy::owner);
+    ASSERT_EQ(entt::any_cast<test::aggregate>(other), test::aggregate{2});
+
+    any.reset();
+
+    ASSERT_FALSE(any);
+    ASSERT_EQ(any.data(), nullptr);
+}
+
 TEST(Any, NoSBODestruction) {
     using tracker_type = tracker<entt::any::length>;
 
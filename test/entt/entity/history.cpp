@@ -0,0 +1,131 @@
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/history.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/config.h"
+#include "../../common/empty.h"
+#include "../../common/linter.hpp"
+
+TEST(History, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::history>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::history>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::history>, "Copy assignable type not allowed");
+    static_assert(std::is_move_constructible_v<entt::history>, "Move constructible type required");
+    static_assert(std::is_move_assignable_v<entt::history>, "Move assignable type required");
+
+    entt::registry registry{};
+    entt::history history{registry, 2u};
+
+    ASSERT_EQ(history.size(), 2u);
+    ASSERT_FALSE(history.contains(0u));
+
+    history.record(0u);
+    entt::history other{std::move(history)};
+
+    test::is_initialized(history);
+
+    ASSERT_TRUE(other.contains(0u));
+
+    history = std::move(other);
+    test::is_initialized(other);
+
+    ASSERT_TRUE(history.contains(0u));
+}
+
+TEST(History, RecordAndRestore) {
+    entt::registry registry{};
+    entt::history history{registry, 3u};
+
+    const auto entity = registry.create();
+    registry.emplace<int>(entity, 0);
+    history.record(0u);
+
+    registry.replace<int>(entity, 1);
+    registry.emplace<test::empty>(entity);
+    history.record(1u);
+
+    registry.destroy(entity);
+    history.record(2u);
+
+    ASSERT_TRUE(history.contains(0u));
+    ASSERT_TRUE(history.contains(1u));
+    ASSERT_TRUE(history.contains(2u));
+
+    ASSERT_EQ(history[0u].get<int>(entity), 0);
+    ASSERT_TRUE(history[1u].all_of<test::empty>(entity));
+    ASSERT_FALSE(history[2u].valid(entity));
+
+    history.restore(1u);
+
+    ASSERT_TRUE(registry.valid(entity));
+    ASSERT_EQ(registry.get<int>(entity), 1);
+    ASSERT_TRUE(registry.all_of<test::empty>(entity));
+
+    ASSERT_TRUE(history.contains(0u));
+    ASSERT_TRUE(history.contains(1u));
+    ASSERT_FALSE(history.contains(2u));
+
+    history.restore(0u);
+
+    ASSERT_EQ(registry.get<int>(entity), 0);
+    ASSERT_FALSE(registry.all_of<test::empty>(entity));
+    ASSERT_FALSE(history.contains(1u));
+}
+
+TEST(History, Ring) {
+    entt::registry registry{};
+    entt::history history{registry, 2u};
+
+    for(int frame{}; frame < 4; ++frame) {
+        registry.emplace<int>(registry.create(), frame);
+        history.record(static_cast<std::size_t>(frame));
+    }
+
+    ASSERT_FALSE(history.contains(0u));
+    ASSERT_FALSE(history.contains(1u));
+    ASSERT_TRUE(history.contains(2u));
+    ASSERT_TRUE(history.contains(3u));
+
+    history.restore(2u);
+
+    ASSERT_EQ(registry.storage<int>().size(), 3u);
+
+    history.clear();
+
+    ASSERT_FALSE(history.contains(2u));
+    ASSERT_FALSE(history.contains(3u));
+}
+
+TEST(History, EntityStorage) {
+    entt::registry registry{};
+    entt::history history{registry, 2u};
+
+    const std::array entity{registry.create(), registry.create()};
+    registry.destroy(entity[0u]);
+    history.record(0u);
+
+    const auto created = registry.create();
+
+    ASSERT_EQ(entt::to_entity(created), entt::to_entity(entity[0u]));
+
+    registry.destroy(created);
+    registry.destroy(entity[1u]);
+    [[maybe_unused]] const auto other = registry.create();
+    history.restore(0u);
+
+    ASSERT_EQ(registry.storage<entt::entity>().free_list(), 1u);
+    ASSERT_FALSE(registry.valid(entity[0u]));
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.create(), created);
+}
+
+ENTT_DEBUG_TEST(HistoryDeathTest, Restore) {
+    entt::registry registry{};
+    entt::history history{registry, 2u};
+
+    ASSERT_DEATH(history.restore(0u), "");
+    ASSERT_DEATH([[maybe_unused]] const auto &elem = history[0u], "");
+}
@@ -0,0 +1,218 @@
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/entity.hpp>
+#include <entt/entity/journal.hpp>
+#include <entt/entity/registry.hpp>
+#include "../../common/config.h"
+#include "../../common/empty.h"
+
+struct position {
+    int x;
+    int y;
+};
+
+struct velocity {
+    velocity(const int dx, const int dy)
+        : x{dx}, y{dy} {}
+
+    int x;
+    int y;
+};
+
+TEST(Journal, Constructors) {
+    static_assert(!std::is_default_constructible_v<entt::journal>, "Default constructible type not allowed");
+    static_assert(!std::is_copy_constructible_v<entt::journal>, "Copy constructible type not allowed");
+    static_assert(!std::is_copy_assignable_v<entt::journal>, "Copy assignable type not allowed");
+    static_assert(!std::is_move_constructible_v<entt::journal>, "Move constructible type not allowed");
+    static_assert(!std::is_move_assignable_v<entt::journal>, "Move assignable type not allowed");
+
+    entt::registry registry{};
+    entt::journal journal{registry, 64u};
+
+    ASSERT_TRUE(journal.empty());
+    ASSERT_EQ(journal.size(), 0u);
+    ASSERT_TRUE(journal.tracked(entt::type_hash<entt::entity>::value()));
+    ASSERT_FALSE(journal.tracked(entt::type_hash<int>::value()));
+
+    journal.disconnect();
+}
+
+TEST(Journal, Functionalities) {
+    entt::registry registry{};
+    entt::journal journal{registry};
+
+    journal.track<int>().track<position>();
+
+    ASSERT_TRUE(journal.tracked(entt::type_hash<int>::value()));
+    ASSERT_TRUE(journal.tracked(entt::type_hash<position>::value()));
+
+    const auto entity = registry.create();
+
+    ASSERT_FALSE(journal.empty());
+
+    const auto size = journal.size();
+    registry.emplace<char>(entity, 'c');
+
+    ASSERT_EQ(journal.size(), size);
+
+    registry.emplace<int>(entity, 1);
+
+    ASSERT_GT(journal.size(), size);
+
+    journal.clear();
+
+    ASSERT_TRUE(journal.empty());
+
+    journal.disconnect();
+    registry.destroy(entity);
+
+    ASSERT_TRUE(journal.empty());
+    ASSERT_FALSE(journal.tracked(entt::type_hash<int>::value()));
+}
+
+TEST(Journal, Replay) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    entt::registry other{};
+    entt::journal journal{registry};
+
+    journal.track<int>().track<position>().track<test::empty>().track<int>("other"_hs);
+
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    registry.emplace<int>(entity[0u], 1);
+    registry.emplace<position>(entity[0u], 2, 3);
+    registry.emplace<test::empty>(entity[1u]);
+    registry.storage<int>("other"_hs).emplace(entity[2u], 4);
+    registry.patch<position>(entity[0u], [](auto &elem) { elem.x = 5; });
+    registry.replace<int>(entity[0u], 6);
+    registry.erase<test::empty>(entity[1u]);
+    registry.destroy(entity[1u]);
+    registry.emplace<char>(entity[2u], 'c');
+
+    const auto created = registry.create();
+    registry.emplace<int>(created, 7);
+
+    ASSERT_TRUE(journal.replay(other));
+
+    ASSERT_EQ(other.storage<entt::entity>().size(), registry.storage<entt::entity>().size());
+    ASSERT_EQ(other.storage<entt::entity>().free_list(), registry.storage<entt::entity>().free_list());
+
+    ASSERT_TRUE(other.valid(entity[0u]));
+    ASSERT_FALSE(other.valid(entity[1u]));
+    ASSERT_TRUE(other.valid(entity[2u]));
+    ASSERT_TRUE(other.valid(created));
+
+    ASSERT_EQ(other.get<int>(entity[0u]), 6);
+    ASSERT_EQ(other.get<position>(entity[0u]).x, 5);
+    ASSERT_EQ(other.get<position>(entity[0u]).y, 3);
+    ASSERT_TRUE(other.storage<test::empty>().empty());
+    ASSERT_EQ(other.storage<int>("other"_hs).get(entity[2u]), 4);
+    ASSERT_FALSE(other.all_of<char>(entity[2u]));
+    ASSERT_EQ(other.get<int>(created), 7);
+
+    const std::vector<std::byte> log{journal.data(), journal.data() + journal.size()};
+    entt::registry last{};
+
+    ASSERT_TRUE(journal.replay(last, log.data(), log.size()));
+
+    ASSERT_EQ(last.get<int>(entity[0u]), 6);
+    ASSERT_EQ(last.get<int>(created), 7);
+
+    journal.disconnect();
+}
+
+TEST(Journal, NonDefaultConstructible) {
+    static_assert(!std::is_default_constructible_v<velocity>, "Default constructible type not allowed");
+
+    entt::registry registry{};
+    entt::registry other{};
+    entt::journal journal{registry};
+
+    journal.track<velocity>();
+
+    const auto entity = registry.create();
+    registry.emplace<velocity>(entity, 1, 2);
+
+    ASSERT_TRUE(journal.replay(other));
+
+    ASSERT_TRUE(other.all_of<velocity>(entity));
+    ASSERT_EQ(other.get<velocity>(entity).x, 1);
+    ASSERT_EQ(other.get<velocity>(entity).y, 2);
+
+    journal.disconnect();
+}
+
+TEST(Journal, Version) {
+    entt::registry registry{};
+    entt::registry other{};
+    entt::journal journal{registry};
+
+    const auto entity = registry.create();
+    registry.destroy(entity);
+
+    ASSERT_TRUE(journal.replay(other));
+
+    ASSERT_EQ(other.current(entity), registry.current(entity));
+
+    registry.destroy(registry.create(), 3u);
+    const auto created = registry.create();
+    entt::registry last{};
+
+    ASSERT_TRUE(journal.replay(last));
+
+    ASSERT_EQ(entt::to_version(created), 3u);
+    ASSERT_EQ(last.current(created), registry.current(created));
+    ASSERT_TRUE(last.valid(created));
+
+    journal.disconnect();
+}
+
+TEST(Journal, InvalidLog) {
+    entt::registry registry{};
+    entt::registry other{};
+    entt::journal journal{registry};
+
+    journal.track<position>();
+
+    const auto entity = registry.create();
+    registry.emplace<position>(entity, 1, 2);
+
+    const std::vector<std::byte> log{journal.data(), journal.data() + journal.size()};
+
+    // the payload of the last record is missing
+    ASSERT_FALSE(journal.replay(other, log.data(), log.size() - 1u));
+    ASSERT_TRUE(other.valid(entity));
+    ASSERT_FALSE(other.all_of<position>(entity));
+
+    entt::registry untracked{};
+    entt::registry last{};
+    entt::journal partial{untracked};
+
+    // positions aren't tracked by this journal
+    ASSERT_FALSE(partial.replay(last, log.data(), log.size()));
+    ASSERT_TRUE(last.valid(entity));
+
+    // truncated header
+    ASSERT_FALSE(journal.replay(last, log.data(), 1u));
+
+    partial.disconnect();
+    journal.disconnect();
+}
+
+ENTT_DEBUG_TEST(JournalDeathTest, Track) {
+    entt::registry registry{};
+    entt::journal journal{registry};
+
+    journal.track<int>();
+
+    ASSERT_DEATH(journal.track<int>(), "");
+    ASSERT_DEATH(journal.replay(registry), "");
+
+    journal.disconnect();
+}
@@ -244,6 +244,121 @@ TEST(Registry, Functionalities) {
     ASSERT_TRUE(registry.storage<int>().empty());
 }
 
+TEST(Registry, Fork) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    listener listener{};
+
+    registry.emplace<int>(entity[0u], 0);
+    registry.emplace<int>(entity[1u], 1);
+    registry.emplace<char>(entity[1u], 'c');
+    registry.emplace<test::empty>(entity[2u]);
+    registry.storage<double>("other"_hs).emplace(entity[2u], 2.);
+    registry.on_construct<int>().connect<&listener::incr>(listener);
+    registry.destroy(entity[0u]);
+
+    entt::registry other = registry.fork();
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(other.storage<entt::entity>().size(), registry.storage<entt::entity>().size());
+    ASSERT_EQ(other.storage<entt::entity>().free_list(), registry.storage<entt::entity>().free_list());
+
+    ASSERT_FALSE(other.valid(entity[0u]));
+    ASSERT_TRUE(other.valid(entity[1u]));
+    ASSERT_TRUE(other.valid(entity[2u]));
+
+    ASSERT_EQ(other.get<int>(entity[1u]), 1);
+    ASSERT_EQ(other.get<char>(entity[1u]), 'c');
+    ASSERT_TRUE(other.all_of<test::empty>(entity[2u]));
+    ASSERT_EQ(other.storage<double>("other"_hs).get(entity[2u]), 2.);
+
+    registry.patch<int>(entity[1u], [](auto &value) { value = 3; });
+    registry.destroy(entity[2u]);
+
+    ASSERT_EQ(other.get<int>(entity[1u]), 1);
+    ASSERT_TRUE(other.valid(entity[2u]));
+
+    const auto created = other.create();
+
+    ASSERT_EQ(entt::to_entity(created), entt::to_entity(entity[0u]));
+
+    other.emplace<int>(created);
+
+    ASSERT_EQ(listener.counter, 0);
+
+    other.destroy(entity[1u]);
+
+    ASSERT_TRUE(registry.valid(entity[1u]));
+    ASSERT_EQ(registry.get<int>(entity[1u]), 3);
+}
+
+TEST(Registry, CloneInto) {
+    entt::registry registry{};
+    entt::registry other{};
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+    listener listener{};
+
+    registry.emplace<int>(entity[0u], 0);
+    registry.emplace<int>(entity[1u], 1);
+    registry.emplace<char>(entity[1u], 'c');
+    registry.destroy(entity[0u]);
+
+    other.on_construct<int>().connect<&listener::incr>(listener);
+    other.emplace<double>(other.create(), 2.);
+
+    registry.clone_into(other);
+
+    ASSERT_EQ(listener.counter, 0);
+    ASSERT_EQ(other.storage<entt::entity>().size(), registry.storage<entt::entity>().size());
+    ASSERT_EQ(other.storage<entt::entity>().free_list(), registry.storage<entt::entity>().free_list());
+
+    ASSERT_FALSE(other.valid(entity[0u]));
+    ASSERT_TRUE(other.valid(entity[1u]));
+    ASSERT_TRUE(other.valid(entity[2u]));
+
+    ASSERT_EQ(other.get<int>(entity[1u]), 1);
+    ASSERT_EQ(other.get<char>(entity[1u]), 'c');
+    ASSERT_TRUE(other.storage<double>().empty());
+
+    const auto *data = other.storage<int>().raw()[0u];
+    registry.replace<int>(entity[1u], 3);
+    registry.emplace<int>(entity[2u], 2);
+    registry.clone_into(other);
+
+    ASSERT_EQ(other.storage<int>().raw()[0u], data);
+    ASSERT_EQ(other.get<int>(entity[1u]), 3);
+    ASSERT_EQ(other.get<int>(entity[2u]), 2);
+
+    other.emplace<int>(other.create());
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_FALSE(registry.all_of<int>(entity[0u]));
+}
+
+TEST(Registry, CloneIntoMismatch) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    entt::registry other{};
+    const auto entity = registry.create();
+    listener listener{};
+
+    registry.storage<int>("other"_hs).emplace(entity, 1);
+    other.storage<char>("other"_hs).emplace(other.create(), 'c');
+    other.on_destroy<double>().connect<&listener::incr>(listener);
+    other.emplace<double>(other.create(), 2.);
+
+    registry.clone_into(other);
+
+    ASSERT_EQ(listener.counter, 1);
+    ASSERT_TRUE(other.storage<double>().empty());
+    ASSERT_EQ(other.storage("other"_hs)->type(), entt::type_id<int>());
+    ASSERT_TRUE(other.valid(entity));
+    ASSERT_EQ(other.storage<int>("other"_hs).get(entity), 1);
+}
+
 TEST(Registry, Constructors) {
     entt::registry registry{};
     entt::registry other{64u};
@@ -531,6 +646,35 @@ ENTT_DEBUG_TEST(RegistryDeathTest, Storage) {
     ASSERT_DEATH([[maybe_unused]] const auto *storage = std::as_const(registry).storage<entt::entity>("other"_hs), "");
 }
 
+TEST(Registry, StorageCache) {
+    using namespace entt::literals;
+
+    entt::registry registry{};
+    const auto *storage = std::as_const(registry).storage<int>();
+
+    ASSERT_EQ(storage, nullptr);
+
+    auto &other = registry.storage<int>("other"_hs);
+    storage = &registry.storage<int>();
+
+    ASSERT_NE(storage, &other);
+    ASSERT_EQ(std::as_const(registry).storage<int>(), storage);
+    ASSERT_EQ(&registry.storage<int>(), storage);
+    ASSERT_EQ(&registry.storage<int>("other"_hs), &other);
+    ASSERT_EQ(registry.storage(entt::type_hash<int>::value()), storage);
+
+    entt::registry moved{std::move(registry)};
+
+    ASSERT_EQ(&moved.storage<int>(), storage);
+    ASSERT_EQ(&moved.storage<int>("other"_hs), &other);
+
+    entt::registry swapped{};
+    swapped.swap(moved);
+
+    ASSERT_EQ(&swapped.storage<int>(), storage);
+    ASSERT_NE(&moved.storage<int>(), storage);
+}
+
 TEST(Registry, Identifiers) {
     using traits_type = entt::entt_traits<entt::entity>;
 
@@ -3,6 +3,7 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/core/any.hpp>
 #include <entt/core/type_info.hpp>
@@ -23,6 +24,24 @@ void listener(std::size_t &counter, Registry &, typename Registry::entity_type)
     ++counter;
 }
 
+template<typename Registry, typename It>
+void range_listener(std::size_t &counter, Registry &, It first, It last) {
+    for(; first != last; ++first) {
+        counter += (*first != entt::tombstone);
+    }
+}
+
+template<typename Registry, typename It>
+void range_recorder(std::vector<std::vector<typename Registry::entity_type>> &ranges, Registry &, It first, It last) {
+    auto &elem = ranges.emplace_back();
+
+    for(; first != last; ++first) {
+        if(*first != entt::tombstone) {
+            elem.push_back(*first);
+        }
+    }
+}
+
 struct custom_registry: entt::basic_registry<test::entity> {};
 
 template<typename Type>
@@ -115,6 +134,80 @@ TYPED_TEST(SighMixin, Functionalities) {
     ASSERT_EQ(pool.size(), 0u);
 }
 
+TYPED_TEST(SighMixin, RangeSignals) {
+    using value_type = typename TestFixture::type;
+    using iterator = typename entt::sparse_set::iterator;
+    using range_type = std::vector<entt::entity>;
+
+    entt::registry registry;
+    auto &pool = registry.storage<value_type>();
+    const std::array entity{registry.create(), registry.create(), registry.create()};
+
+    std::size_t on_construct{};
+    std::vector<range_type> on_destroy{};
+
+    pool.on_construct_range().template connect<&range_listener<entt::registry, iterator>>(on_construct);
+    pool.on_destroy_range().template connect<&range_recorder<entt::registry, iterator>>(on_destroy);
+
+    pool.insert(entity.begin(), entity.end());
+
+    ASSERT_EQ(on_construct, 3u);
+    ASSERT_TRUE(on_destroy.empty());
+
+    pool.erase(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(on_construct, 3u);
+    ASSERT_EQ(on_destroy.size(), 1u);
+    ASSERT_EQ(on_destroy[0u], (range_type{entity[0u], entity[1u]}));
+
+    pool.insert(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(on_construct, 5u);
+
+    entt::sparse_set other{};
+    other.push(entity[2u]);
+    other.push(entity[0u]);
+    pool.erase(other.begin(), other.end());
+
+    ASSERT_EQ(on_destroy.size(), 2u);
+    ASSERT_EQ(on_destroy[1u], (range_type{entity[0u], entity[2u]}));
+
+    const std::array candidate{entity[2u], entity[1u], entity[0u], entity[1u]};
+
+    ASSERT_EQ(pool.remove(candidate.begin(), candidate.end()), 1u);
+    ASSERT_EQ(on_destroy.size(), 3u);
+    ASSERT_EQ(on_destroy[2u], (range_type{entity[1u]}));
+
+    pool.insert(entity.begin(), entity.end());
+    other.push(entity[1u]);
+    other.erase(entity[2u]);
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(pool.remove(other.begin(), other.end()), 1u);
+    ASSERT_EQ(on_destroy.size(), 5u);
+    ASSERT_EQ(on_destroy[4u], (range_type{entity[0u]}));
+
+    pool.insert(entity.begin(), entity.begin() + 2u);
+
+    ASSERT_EQ(pool.remove(candidate.begin(), candidate.end()), 3u);
+    ASSERT_EQ(on_destroy.size(), 6u);
+    ASSERT_EQ(on_destroy[5u], (range_type{entity[2u], entity[1u], entity[0u]}));
+
+    pool.emplace(entity[0u]);
+
+    ASSERT_EQ(on_construct, 11u);
+
+    std::size_t per_entity{};
+    pool.on_destroy().template connect<&listener<entt::registry>>(per_entity);
+    pool.clear();
+
+    ASSERT_EQ(on_construct, 11u);
+    ASSERT_EQ(on_destroy.size(), 7u);
+    ASSERT_EQ(on_destroy[6u], (range_type{entity[0u]}));
+    ASSERT_EQ(per_entity, 1u);
+    ASSERT_TRUE(pool.empty());
+}
+
 TYPED_TEST(SighMixin, InsertWeakRange) {
     using value_type = typename TestFixture::type;
 
@@ -295,6 +388,35 @@ TEST(SighMixin, StorageEntity) {
     ASSERT_EQ(pool.free_list(), 0u);
 }
 
+TEST(SighMixin, StorageEntityRangeSignals) {
+    using iterator = typename entt::sparse_set::iterator;
+
+    entt::registry registry;
+    auto &pool = registry.storage<entt::entity>();
+
+    std::size_t on_construct{};
+    std::size_t on_destroy{};
+
+    pool.on_construct_range().connect<&range_listener<entt::registry, iterator>>(on_construct);
+    pool.on_destroy_range().connect<&range_listener<entt::registry, iterator>>(on_destroy);
+
+    std::array<entt::entity, 3u> entity{};
+    pool.insert(entity.begin(), entity.end());
+    pool.emplace();
+
+    ASSERT_EQ(on_construct, 4u);
+    ASSERT_EQ(on_destroy, 0u);
+
+    pool.erase(entity[1u]);
+
+    ASSERT_EQ(on_destroy, 1u);
+
+    pool.clear();
+
+    ASSERT_EQ(on_construct, 4u);
+    ASSERT_EQ(on_destroy, 4u);
+}
+
 TYPED_TEST(SighMixin, Move) {
     using value_type = typename TestFixture::type;
 
@@ -404,6 +526,33 @@ TYPED_TEST(SighMixin, Swap) {
     ASSERT_EQ(on_destroy, 3u);
 }
 
+TYPED_TEST(SighMixin, Fork) {
+    using value_type = typename TestFixture::type;
+
+    entt::sigh_mixin<entt::storage<value_type>> pool;
+    entt::registry registry;
+
+    std::size_t on_construct{};
+
+    pool.bind(entt::forward_as_any(registry));
+    pool.on_construct().template connect<&listener<entt::registry>>(on_construct);
+    pool.emplace(entt::entity{3}, 3);
+
+    const auto base = pool.fork();
+    auto &other = static_cast<entt::sigh_mixin<entt::storage<value_type>> &>(*base);
+
+    ASSERT_EQ(on_construct, 1u);
+    ASSERT_EQ(other.type(), entt::type_id<value_type>());
+    ASSERT_EQ(other.get(entt::entity{3}), value_type{3});
+    ASSERT_TRUE(other.on_construct().empty());
+
+    other.bind(entt::forward_as_any(registry));
+    other.emplace(entt::entity{1}, 1);
+
+    ASSERT_EQ(on_construct, 1u);
+    ASSERT_FALSE(pool.contains(entt::entity{1}));
+}
+
 TYPED_TEST(SighMixin, CustomRegistry) {
     using value_type = typename TestFixture::type;
 
@@ -169,6 +169,77 @@ TYPED_TEST(SparseSet, Swap) {
     }
 }
 
+TYPED_TEST(SparseSet, Fork) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        set.push(entity_type{3});
+        set.push(entity_type{1});
+        set.push(entity_type{4});
+        set.erase(entity_type{1});
+
+        const auto other = set.fork();
+
+        ASSERT_NE(other, nullptr);
+        ASSERT_EQ(other->policy(), policy);
+        ASSERT_EQ(other->type(), set.type());
+        ASSERT_EQ(other->size(), set.size());
+        ASSERT_EQ(other->free_list(), set.free_list());
+
+        ASSERT_TRUE(std::equal(set.begin(), set.end(), other->begin(), other->end()));
+        ASSERT_TRUE(other->contains(entity_type{3}));
+        ASSERT_FALSE(other->contains(entity_type{1}));
+        ASSERT_TRUE(other->contains(entity_type{4}));
+
+        set.erase(entity_type{3});
+
+        ASSERT_FALSE(set.contains(entity_type{3}));
+        ASSERT_TRUE(other->contains(entity_type{3}));
+        ASSERT_NE(set.data(), other->data());
+    }
+}
+
+TYPED_TEST(SparseSet, CloneInto) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+    using traits_type = entt::entt_traits<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+        sparse_set_type other{policy};
+
+        set.push(entity_type{3});
+        set.push(entity_type{1});
+        set.push(entity_type{4});
+        set.erase(entity_type{1});
+
+        other.push(entity_type{1});
+        other.push(entity_type{traits_type::page_size});
+
+        set.clone_into(other);
+
+        ASSERT_EQ(other.size(), set.size());
+        ASSERT_EQ(other.free_list(), set.free_list());
+
+        ASSERT_TRUE(std::equal(set.begin(), set.end(), other.begin(), other.end()));
+        ASSERT_TRUE(other.contains(entity_type{3}));
+        ASSERT_FALSE(other.contains(entity_type{1}));
+        ASSERT_TRUE(other.contains(entity_type{4}));
+        ASSERT_FALSE(other.contains(entity_type{traits_type::page_size}));
+
+        const auto *data = other.data();
+        set.clear();
+        set.clone_into(other);
+
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(other.data(), data);
+        ASSERT_FALSE(other.contains(entity_type{3}));
+    }
+}
+
 TYPED_TEST(SparseSet, FreeList) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
@@ -928,6 +999,45 @@ ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Value) {
     }
 }
 
+TYPED_TEST(SparseSet, Span) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        set.push(entity_type{3});
+        set.push(entity_type{1});
+
+        const auto span = set.span(0u);
+
+        ASSERT_EQ(span.base, nullptr);
+        ASSERT_EQ(span.stride, 0u);
+        ASSERT_EQ(span.count, 2u);
+        ASSERT_EQ(set.span(1u).count, 1u);
+    }
+}
+
+ENTT_DEBUG_TYPED_TEST(SparseSetDeathTest, Span) {
+    using entity_type = typename TestFixture::type;
+    using sparse_set_type = entt::basic_sparse_set<entity_type>;
+
+    for(const auto policy: this->deletion_policy) {
+        sparse_set_type set{policy};
+
+        // span works the same in all cases, test only once
+        switch(policy) {
+        case entt::deletion_policy::swap_and_pop:
+            ASSERT_DEATH([[maybe_unused]] const auto span = set.span(0u), "");
+            break;
+        case entt::deletion_policy::in_place:
+        case entt::deletion_policy::swap_only:
+            SUCCEED();
+            break;
+        }
+    }
+}
+
 TYPED_TEST(SparseSet, Push) {
     using entity_type = typename TestFixture::type;
     using sparse_set_type = entt::basic_sparse_set<entity_type>;
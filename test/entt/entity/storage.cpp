@@ -192,6 +192,130 @@ TYPED_TEST(Storage, Swap) {
     ASSERT_EQ(other.get(entt::entity{4}), value_type{1});
 }
 
+TYPED_TEST(Storage, Fork) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+
+    pool.emplace(entt::entity{3}, 3);
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{4}, 4);
+    pool.erase(entt::entity{1});
+
+    const auto base = pool.fork();
+    auto &other = static_cast<entt::storage<value_type> &>(*base);
+
+    ASSERT_EQ(other.type(), entt::type_id<value_type>());
+    ASSERT_EQ(other.size(), 2u + traits_type::in_place_delete);
+    ASSERT_EQ(other.free_list(), pool.free_list());
+
+    ASSERT_TRUE(other.contains(entt::entity{3}));
+    ASSERT_FALSE(other.contains(entt::entity{1}));
+    ASSERT_TRUE(other.contains(entt::entity{4}));
+
+    ASSERT_EQ(other.index(entt::entity{3}), pool.index(entt::entity{3}));
+    ASSERT_EQ(other.index(entt::entity{4}), pool.index(entt::entity{4}));
+    ASSERT_EQ(other.get(entt::entity{3}), value_type{3});
+    ASSERT_EQ(other.get(entt::entity{4}), value_type{4});
+
+    pool.patch(entt::entity{3}, [](auto &elem) { elem = value_type{2}; });
+    pool.erase(entt::entity{4});
+
+    ASSERT_EQ(pool.get(entt::entity{3}), value_type{2});
+    ASSERT_EQ(other.get(entt::entity{3}), value_type{3});
+    ASSERT_TRUE(other.contains(entt::entity{4}));
+
+    other.emplace(entt::entity{1}, 1);
+
+    ASSERT_FALSE(pool.contains(entt::entity{1}));
+    ASSERT_EQ(other.get(entt::entity{1}), value_type{1});
+}
+
+TYPED_TEST(Storage, CloneInto) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+    entt::storage<value_type> other;
+
+    pool.emplace(entt::entity{3}, 3);
+    pool.emplace(entt::entity{1}, 1);
+    pool.emplace(entt::entity{traits_type::page_size}, 4);
+    pool.erase(entt::entity{1});
+
+    other.emplace(entt::entity{1}, 0);
+    other.emplace(entt::entity{2}, 0);
+
+    pool.clone_into(other);
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_EQ(other.free_list(), pool.free_list());
+
+    ASSERT_FALSE(other.contains(entt::entity{1}));
+    ASSERT_FALSE(other.contains(entt::entity{2}));
+    ASSERT_TRUE(other.contains(entt::entity{3}));
+    ASSERT_TRUE(other.contains(entt::entity{traits_type::page_size}));
+
+    ASSERT_EQ(other.index(entt::entity{3}), pool.index(entt::entity{3}));
+    ASSERT_EQ(other.get(entt::entity{3}), value_type{3});
+    ASSERT_EQ(other.get(entt::entity{traits_type::page_size}), value_type{4});
+
+    const auto *page = other.raw()[0u];
+    pool.patch(entt::entity{3}, [](auto &elem) { elem = value_type{2}; });
+    pool.clone_into(other);
+
+    ASSERT_EQ(other.raw()[0u], page);
+    ASSERT_EQ(other.get(entt::entity{3}), value_type{2});
+
+    pool.clear();
+    pool.clone_into(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_FALSE(other.contains(entt::entity{3}));
+}
+
+TEST(Storage, CloneIntoNonTrivialType) {
+    entt::storage<std::unordered_set<char>> pool;
+    entt::storage<std::unordered_set<char>> other;
+
+    pool.emplace(entt::entity{1}, std::unordered_set<char>{'a'});
+    pool.emplace(entt::entity{3}, std::unordered_set<char>{'b'});
+    pool.emplace(entt::entity{5}, std::unordered_set<char>{'c', 'd'});
+    pool.erase(entt::entity{3});
+
+    other.emplace(entt::entity{3}, std::unordered_set<char>{'e'});
+
+    pool.clone_into(other);
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_TRUE(other.contains(entt::entity{1}));
+    ASSERT_FALSE(other.contains(entt::entity{3}));
+    ASSERT_TRUE(other.contains(entt::entity{5}));
+
+    ASSERT_EQ(other.get(entt::entity{1}), std::unordered_set<char>{'a'});
+    ASSERT_EQ(other.get(entt::entity{5}), (std::unordered_set<char>{'c', 'd'}));
+}
+
+TEST(Storage, CloneIntoThrowingComponent) {
+    entt::storage<test::throwing_type> pool;
+    entt::storage<test::throwing_type> other;
+
+    pool.emplace(entt::entity{1}, false);
+    pool.emplace(entt::entity{2}, true);
+    other.emplace(entt::entity{3}, false);
+
+    // basic exception safety
+    ASSERT_THROW(pool.clone_into(other), test::throwing_type_exception);
+    ASSERT_TRUE(other.empty());
+    ASSERT_FALSE(other.contains(entt::entity{1}));
+    ASSERT_FALSE(other.contains(entt::entity{3}));
+
+    pool.get(entt::entity{2}).throw_on_copy(false);
+    pool.clone_into(other);
+
+    ASSERT_EQ(other.size(), 2u);
+    ASSERT_TRUE(other.contains(entt::entity{2}));
+}
+
 TYPED_TEST(Storage, Capacity) {
     using value_type = typename TestFixture::type;
     using traits_type = entt::component_traits<value_type>;
@@ -598,6 +722,41 @@ ENTT_DEBUG_TYPED_TEST(StorageDeathTest, Value) {
     ASSERT_DEATH([[maybe_unused]] const void *value = pool.value(entt::entity{2}), "");
 }
 
+TYPED_TEST(Storage, Span) {
+    using value_type = typename TestFixture::type;
+    using traits_type = entt::component_traits<value_type>;
+    entt::storage<value_type> pool;
+    std::size_t visited{};
+
+    for(std::size_t pos{}; pos < traits_type::page_size + 2u; ++pos) {
+        pool.emplace(static_cast<entt::entity>(pos), static_cast<int>(pos));
+    }
+
+    for(std::size_t pos{}; pos < pool.size(); pos += pool.span(pos).count) {
+        const auto span = pool.span(pos);
+
+        ASSERT_EQ(span.stride, sizeof(value_type));
+        ASSERT_EQ(span.count, (pos == 0u) ? traits_type::page_size : 2u);
+
+        for(std::size_t next{}; next < span.count; ++next) {
+            const auto *elem = static_cast<const value_type *>(static_cast<const void *>(static_cast<const std::byte *>(span.base) + next * span.stride));
+            ASSERT_EQ(elem, &pool.get(pool.data()[pos + next]));
+            ++visited;
+        }
+    }
+
+    ASSERT_EQ(visited, pool.size());
+    ASSERT_EQ(pool.span(1u).count, traits_type::page_size - 1u);
+    ASSERT_EQ(pool.span(1u).base, &pool.get(pool.data()[1u]));
+}
+
+ENTT_DEBUG_TYPED_TEST(StorageDeathTest, Span) {
+    using value_type = typename TestFixture::type;
+    entt::storage<value_type> pool;
+
+    ASSERT_DEATH([[maybe_unused]] const auto span = pool.span(0u), "");
+}
+
 TYPED_TEST(Storage, Emplace) {
     using value_type = typename TestFixture::type;
     entt::storage<value_type> pool;
@@ -106,6 +106,49 @@ TEST(StorageEntity, Swap) {
     ASSERT_EQ(other.index(entt::entity{4}), 0u);
 }
 
+TEST(StorageEntity, Fork) {
+    entt::storage<entt::entity> pool;
+
+    const auto entity = pool.emplace();
+    const auto other = pool.emplace();
+    pool.erase(entity);
+
+    const auto base = pool.fork();
+    auto &elem = static_cast<entt::storage<entt::entity> &>(*base);
+
+    ASSERT_EQ(elem.size(), pool.size());
+    ASSERT_EQ(elem.free_list(), pool.free_list());
+    ASSERT_EQ(elem.current(entity), pool.current(entity));
+    ASSERT_TRUE(elem.contains(other));
+
+    ASSERT_EQ(elem.emplace(), pool.emplace());
+    ASSERT_EQ(elem.emplace(), pool.emplace());
+    ASSERT_EQ(elem.size(), pool.size());
+}
+
+TEST(StorageEntity, CloneInto) {
+    entt::storage<entt::entity> pool;
+    entt::storage<entt::entity> other;
+
+    const auto entity = pool.emplace();
+    pool.emplace();
+    pool.erase(entity);
+
+    other.emplace();
+    other.emplace();
+    other.emplace();
+
+    pool.clone_into(other);
+
+    ASSERT_EQ(other.size(), pool.size());
+    ASSERT_EQ(other.free_list(), pool.free_list());
+    ASSERT_EQ(other.current(entity), pool.current(entity));
+
+    ASSERT_EQ(other.emplace(), pool.emplace());
+    ASSERT_EQ(other.emplace(), pool.emplace());
+    ASSERT_EQ(other.size(), pool.size());
+}
+
 TEST(StorageEntity, Getters) {
     entt::storage<entt::entity> pool;
 
@@ -198,6 +198,18 @@ ENTT_DEBUG_TYPED_TEST(StorageNoInstanceDeathTest, Value) {
     ASSERT_DEATH([[maybe_unused]] const void *value = pool.value(entt::entity{4}), "");
 }
 
+TYPED_TEST(StorageNoInstance, Span) {
+    using value_type = typename TestFixture::type;
+    entt::storage<value_type> pool;
+
+    pool.emplace(entt::entity{4});
+    pool.emplace(entt::entity{2});
+
+    ASSERT_EQ(pool.span(0u).base, nullptr);
+    ASSERT_EQ(pool.span(0u).stride, 0u);
+    ASSERT_EQ(pool.span(0u).count, 2u);
+}
+
 TYPED_TEST(StorageNoInstance, Emplace) {
     using value_type = typename TestFixture::type;
     entt::storage<value_type> pool;
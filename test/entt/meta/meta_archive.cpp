@@ -0,0 +1,331 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/entity/registry.hpp>
+#include <entt/entity/snapshot.hpp>
+#include <entt/meta/archive.hpp>
+#include <entt/meta/context.hpp>
+#include <entt/meta/factory.hpp>
+#include <entt/meta/meta.hpp>
+#include "../../common/empty.h"
+
+struct position {
+    float x{};
+    float y{};
+};
+
+struct padded {
+    std::uint8_t tag{};
+    std::uint32_t value{};
+    std::uint32_t ignored{};
+};
+
+struct character {
+    position pos{};
+    std::vector<position> path{};
+    std::vector<int> items{};
+    std::uint8_t level{};
+};
+
+struct pointer {
+    int *value{};
+};
+
+struct accessor {
+    void set(int elem) {
+        value = elem;
+    }
+
+    [[nodiscard]] int get() const {
+        return value;
+    }
+
+    int value{};
+};
+
+struct located: position {
+    float z{};
+};
+
+struct tagged: test::empty {
+    std::vector<int> values{};
+};
+
+struct MetaArchive: ::testing::Test {
+    void SetUp() override {
+        using namespace entt::literals;
+
+        entt::meta<position>()
+            .type("position"_hs)
+            .data<&position::y>("y"_hs)
+            .data<&position::x>("x"_hs);
+
+        entt::meta<padded>()
+            .type("padded"_hs)
+            .data<&padded::tag>("tag"_hs)
+            .data<&padded::value>("value"_hs);
+
+        entt::meta<character>()
+            .type("character"_hs)
+            .data<&character::pos>("pos"_hs)
+            .data<&character::path>("path"_hs)
+            .data<&character::items>("items"_hs)
+            .data<&character::level>("level"_hs);
+
+        entt::meta<pointer>()
+            .type("pointer"_hs)
+            .data<&pointer::value>("value"_hs);
+
+        entt::meta<accessor>()
+            .type("accessor"_hs)
+            .data<&accessor::set, &accessor::get>("value"_hs);
+
+        entt::meta<located>()
+            .type("located"_hs)
+            .base<position>()
+            .data<&located::z>("z"_hs);
+
+        entt::meta<test::empty>()
+            .type("empty"_hs);
+
+        entt::meta<tagged>()
+            .type("tagged"_hs)
+            .base<test::empty>()
+            .data<&tagged::values>("values"_hs);
+    }
+
+    void TearDown() override {
+        entt::meta_reset();
+    }
+};
+
+TEST_F(MetaArchive, Functionalities) {
+    const character instance{{1.f, 2.f}, {{3.f, 4.f}, {5.f, 6.f}}, {7, 8, 9}, 10u};
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(instance);
+
+    ASSERT_FALSE(buffer.empty());
+
+    character other{{}, {{0.f, 0.f}, {0.f, 0.f}, {0.f, 0.f}}, {}, 0u};
+    entt::meta_input_archive input{buffer};
+
+    input(other);
+
+    ASSERT_EQ(input.position(), buffer.size());
+    ASSERT_EQ(other.pos.x, 1.f);
+    ASSERT_EQ(other.pos.y, 2.f);
+    ASSERT_EQ(other.path.size(), 2u);
+    ASSERT_EQ(other.path[0u].x, 3.f);
+    ASSERT_EQ(other.path[1u].y, 6.f);
+    ASSERT_EQ(other.items, (std::vector<int>{7, 8, 9}));
+    ASSERT_EQ(other.level, 10u);
+}
+
+TEST_F(MetaArchive, Plan) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(position{1.f, 2.f});
+
+    // fields are sorted and merged, no matter the order of registration
+    ASSERT_EQ(buffer.size(), sizeof(position));
+
+    padded instance{1u, 2u, 3u};
+    output(instance);
+
+    // padding and fields that aren't reflected are skipped
+    ASSERT_EQ(buffer.size(), sizeof(position) + sizeof(std::uint8_t) + sizeof(std::uint32_t));
+
+    entt::meta_input_archive input{buffer};
+    position pos{};
+    padded other{};
+
+    input(pos);
+    input(other);
+
+    ASSERT_EQ(pos.x, 1.f);
+    ASSERT_EQ(pos.y, 2.f);
+    ASSERT_EQ(other.tag, 1u);
+    ASSERT_EQ(other.value, 2u);
+    ASSERT_EQ(other.ignored, 0u);
+}
+
+TEST_F(MetaArchive, Base) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(located{{1.f, 2.f}, 3.f});
+    output(tagged{{}, {4, 5}});
+
+    ASSERT_TRUE(output);
+    ASSERT_EQ(buffer.size(), sizeof(located) + sizeof(std::size_t) + 2u * sizeof(int));
+
+    entt::meta_input_archive input{buffer};
+    located instance{};
+    tagged other{};
+
+    input(instance);
+    input(other);
+
+    ASSERT_TRUE(input);
+    ASSERT_EQ(input.position(), buffer.size());
+    ASSERT_EQ(instance.x, 1.f);
+    ASSERT_EQ(instance.y, 2.f);
+    ASSERT_EQ(instance.z, 3.f);
+    ASSERT_EQ(other.values, (std::vector<int>{4, 5}));
+}
+
+TEST_F(MetaArchive, NotEnoughData) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+    entt::meta_input_archive input{buffer};
+    position instance{};
+    int value{};
+
+    output(1);
+
+    ASSERT_TRUE(input);
+
+    input(instance);
+
+    ASSERT_FALSE(input);
+    ASSERT_EQ(input.position(), 0u);
+
+    input(value);
+
+    ASSERT_FALSE(input);
+    ASSERT_EQ(value, 0);
+}
+
+TEST_F(MetaArchive, InvalidLength) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+    const character instance{{1.f, 2.f}, {{3.f, 4.f}}, {5}, 6u};
+
+    output(instance);
+
+    ASSERT_TRUE(output);
+
+    // corrupts the length of the path, right after the position
+    const auto length = (std::numeric_limits<std::size_t>::max)();
+    std::memcpy(buffer.data() + sizeof(position), &length, sizeof(length));
+
+    entt::meta_input_archive input{buffer};
+    character other{};
+
+    input(other);
+
+    ASSERT_FALSE(input);
+    ASSERT_EQ(other.pos.x, 1.f);
+    ASSERT_EQ(other.pos.y, 2.f);
+    ASSERT_TRUE(other.path.empty());
+}
+
+TEST_F(MetaArchive, Fundamental) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(42);
+    output(entt::entity{3});
+
+    ASSERT_EQ(buffer.size(), sizeof(int) + sizeof(entt::entity));
+
+    entt::meta_input_archive input{buffer};
+    entt::entity entt{entt::null};
+    int value{};
+
+    input(value);
+    input(entt);
+
+    ASSERT_EQ(value, 42);
+    ASSERT_EQ(entt, entt::entity{3});
+}
+
+TEST_F(MetaArchive, Snapshot) {
+    entt::registry source{};
+    entt::registry destination{};
+    std::vector<std::byte> buffer{};
+
+    const auto e0 = source.create();
+    const auto e1 = source.create();
+    const auto e2 = source.create();
+
+    source.emplace<position>(e0, 1.f, 2.f);
+    source.emplace<position>(e2, 3.f, 4.f);
+    source.emplace<character>(e1, position{5.f, 6.f}, std::vector<position>{{7.f, 8.f}}, std::vector<int>{9}, std::uint8_t{1u});
+    source.emplace<test::empty>(e2);
+    source.destroy(source.create());
+
+    entt::meta_output_archive output{buffer};
+    entt::snapshot{source}.get<entt::entity>(output).get<position>(output).get<character>(output).get<test::empty>(output);
+
+    entt::meta_input_archive input{buffer};
+    entt::snapshot_loader{destination}.get<entt::entity>(input).get<position>(input).get<character>(input).get<test::empty>(input);
+
+    ASSERT_EQ(input.position(), buffer.size());
+    ASSERT_EQ(destination.storage<entt::entity>().size(), source.storage<entt::entity>().size());
+    ASSERT_EQ(destination.storage<entt::entity>().free_list(), source.storage<entt::entity>().free_list());
+
+    ASSERT_TRUE(destination.valid(e0));
+    ASSERT_TRUE(destination.valid(e1));
+    ASSERT_TRUE(destination.valid(e2));
+
+    ASSERT_EQ(destination.get<position>(e0).x, 1.f);
+    ASSERT_EQ(destination.get<position>(e2).y, 4.f);
+    ASSERT_FALSE(destination.all_of<position>(e1));
+
+    ASSERT_EQ(destination.get<character>(e1).pos.y, 6.f);
+    ASSERT_EQ(destination.get<character>(e1).path.size(), 1u);
+    ASSERT_EQ(destination.get<character>(e1).path[0u].x, 7.f);
+    ASSERT_EQ(destination.get<character>(e1).items, std::vector<int>{9});
+    ASSERT_EQ(destination.get<character>(e1).level, 1u);
+
+    ASSERT_TRUE(destination.all_of<test::empty>(e2));
+    ASSERT_FALSE(destination.all_of<test::empty>(e0));
+}
+
+TEST_F(MetaArchive, MetaContext) {
+    using namespace entt::literals;
+
+    entt::meta_ctx ctx{};
+    std::vector<std::byte> buffer{};
+
+    entt::meta<position>(ctx)
+        .type("position"_hs)
+        .data<&position::x>("x"_hs);
+
+    entt::meta_output_archive output{ctx, buffer};
+    output(position{1.f, 2.f});
+
+    ASSERT_EQ(buffer.size(), sizeof(float));
+
+    entt::meta_input_archive input{ctx, buffer};
+    position instance{};
+    input(instance);
+
+    ASSERT_EQ(instance.x, 1.f);
+    ASSERT_EQ(instance.y, 0.f);
+}
+
+TEST_F(MetaArchive, NotSerializable) {
+    std::vector<std::byte> buffer{};
+    entt::meta_output_archive output{buffer};
+
+    output(pointer{});
+
+    ASSERT_FALSE(output);
+    ASSERT_TRUE(buffer.empty());
+
+    entt::meta_output_archive other{buffer};
+    other(accessor{});
+
+    ASSERT_FALSE(other);
+    ASSERT_TRUE(buffer.empty());
+}
+
@@ -192,3 +192,56 @@ TEST_F(MetaBase, ReRegistration) {
     ASSERT_FALSE(node.details->base.empty());
     ASSERT_EQ(node.details->base.size(), 2u);
 }
+
+TEST_F(MetaBase, CastPath) {
+    derived instance{};
+    const auto any = entt::forward_as_meta(instance);
+
+    for(auto next = 0; next < 2; ++next) {
+        // the second round hits the paths resolved during the first one
+        ASSERT_EQ(any.try_cast<base_2>(), static_cast<const base_2 *>(&instance));
+        ASSERT_EQ(any.try_cast<base_3>(), static_cast<const base_3 *>(&instance));
+        ASSERT_EQ(any.try_cast<base_1>(), static_cast<const base_1 *>(&instance));
+        ASSERT_EQ(any.try_cast<int>(), nullptr);
+
+        ASSERT_TRUE(any.allow_cast<int>());
+        ASSERT_TRUE(any.allow_cast<const base_2 &>());
+        ASSERT_FALSE(any.allow_cast<char>());
+    }
+
+    entt::meta_reset<base_3>();
+
+    // paths are discarded when types are reset or registered
+    ASSERT_EQ(any.try_cast<base_2>(), nullptr);
+    ASSERT_FALSE(any.allow_cast<int>());
+
+    entt::meta<base_3>().base<base_2>();
+
+    ASSERT_EQ(any.try_cast<base_2>(), static_cast<const base_2 *>(&instance));
+    ASSERT_TRUE(any.allow_cast<int>());
+}
+
+TEST_F(MetaBase, CastPathFrozen) {
+    entt::meta_ctx context{};
+    derived instance{};
+
+    entt::meta<base_2>(context).conv<int>();
+    entt::meta<base_3>(context).base<base_2>();
+    entt::meta<derived>(context).base<base_1>().base<base_3>();
+
+    entt::meta_freeze(context);
+
+    const auto any = entt::forward_as_meta(context, instance);
+
+    ASSERT_EQ(any.try_cast<base_2>(), static_cast<const base_2 *>(&instance));
+    ASSERT_EQ(any.try_cast<base_1>(), static_cast<const base_1 *>(&instance));
+    ASSERT_EQ(any.try_cast<int>(), nullptr);
+
+    ASSERT_TRUE(any.allow_cast<int>());
+    ASSERT_TRUE(any.allow_cast<const base_3 &>());
+    ASSERT_FALSE(any.allow_cast<char>());
+
+    ASSERT_TRUE(entt::resolve<derived>(context).can_cast(entt::resolve<base_2>(context)));
+    ASSERT_TRUE(entt::resolve<derived>(context).can_convert(entt::resolve<int>(context)));
+    ASSERT_FALSE(entt::resolve<base_1>(context).can_convert(entt::resolve<int>(context)));
+}
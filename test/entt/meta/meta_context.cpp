@@ -1,4 +1,7 @@
+#include <array>
+#include <cstddef>
 #include <iterator>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -12,6 +15,7 @@
 #include <entt/meta/pointer.hpp>
 #include <entt/meta/resolve.hpp>
 #include <entt/meta/template.hpp>
+#include "../../common/config.h"
 #include "../../common/empty.h"
 
 struct base {
@@ -514,3 +518,291 @@ TEST_F(MetaContext, ForwardAsMeta) {
     ASSERT_EQ(global.type().data("marker"_hs).get({}).cast<int>(), global_marker);
     ASSERT_EQ(local.type().data("marker"_hs).get({}).cast<int>(), local_marker);
 }
+
+TEST(MetaFreeze, Functionalities) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+    clazz instance{};
+
+    entt::meta<test::empty>(context)
+        .type("quux"_hs);
+
+    entt::meta<base>(context)
+        .data<&base::value>("char"_hs);
+
+    entt::meta<clazz>(context)
+        .type("bar"_hs)
+        .prop("prop"_hs, 3)
+        .base<base>()
+        .ctor<int>()
+        .data<&clazz::value>("value"_hs)
+        .prop("prop"_hs, 1)
+        .func<&clazz::func>("func"_hs)
+        .func<&clazz::cfunc>("func"_hs)
+        .prop("prop"_hs, 2);
+
+    const auto type = entt::resolve<clazz>(context);
+    entt::meta_any any{context, clazz{}};
+
+    entt::meta_freeze(context);
+    entt::meta_freeze(context);
+
+    ASSERT_TRUE(type);
+    ASSERT_EQ(type, entt::resolve(context, "bar"_hs));
+    ASSERT_EQ(any.type(), type);
+    ASSERT_EQ((std::distance(entt::resolve(context).cbegin(), entt::resolve(context).cend())), 3);
+
+    ASSERT_TRUE(entt::resolve(context, "quux"_hs));
+    ASSERT_EQ(entt::resolve(context, "quux"_hs).data().cbegin(), entt::resolve(context, "quux"_hs).data().cend());
+
+    ASSERT_EQ(type.prop("prop"_hs).value().cast<int>(), 3);
+    ASSERT_EQ(type.data("value"_hs).prop("prop"_hs).value().cast<int>(), 1);
+    ASSERT_TRUE(type.data("char"_hs));
+    ASSERT_NE(type.construct(2).try_cast<base>(), nullptr);
+    ASSERT_EQ(type.construct(2).cast<const clazz &>().value, 2);
+
+    ASSERT_EQ(type.invoke("func"_hs, instance, 4).cast<int>(), 4);
+    ASSERT_EQ(type.invoke("func"_hs, std::as_const(instance), 3).cast<int>(), 3);
+    ASSERT_EQ(instance.value, 4);
+
+    ASSERT_TRUE(type.func("func"_hs).next());
+    ASSERT_FALSE(type.func("func"_hs).next().next());
+    ASSERT_EQ(type.func("func"_hs).next().prop("prop"_hs).value().cast<int>(), 2);
+
+    any.reset();
+    entt::meta_reset(context);
+
+    ASSERT_FALSE(entt::resolve(context, "bar"_hs));
+
+    entt::meta<clazz>(context)
+        .type("bar"_hs);
+
+    ASSERT_TRUE(entt::resolve(context, "bar"_hs));
+}
+
+TEST(MetaFreeze, ConcurrentReads) {
+    using namespace entt::literals;
+
+    constexpr std::size_t count = 1000u;
+    entt::meta_ctx context{};
+    std::array<std::thread, 4u> reader{};
+    std::array<std::size_t, 4u> found{};
+
+    entt::meta<clazz>(context)
+        .type("bar"_hs)
+        .data<&clazz::value>("value"_hs)
+        .func<&clazz::cfunc>("func"_hs);
+
+    entt::meta_freeze(context);
+
+    for(std::size_t pos{}; pos < reader.size(); ++pos) {
+        reader[pos] = std::thread{[&context, &elem = found[pos]]() {
+            const clazz instance{2};
+
+            for(std::size_t next{}; next < count; ++next) {
+                const auto type = entt::resolve(context, "bar"_hs);
+                elem += static_cast<std::size_t>(type.data("value"_hs).get(instance).cast<int>() == 2);
+                elem += static_cast<std::size_t>(type.invoke("func"_hs, instance, 1).cast<int>() == 1);
+            }
+        }};
+    }
+
+    for(auto &&elem: reader) {
+        elem.join();
+    }
+
+    for(auto &&elem: found) {
+        ASSERT_EQ(elem, 2u * count);
+    }
+}
+
+TEST(MetaFreeze, ConcurrentReadsWithoutFreezing) {
+    using namespace entt::literals;
+
+    constexpr std::size_t count = 1000u;
+    entt::meta_ctx context{};
+    std::array<std::thread, 4u> reader{};
+    std::array<std::size_t, 4u> found{};
+
+    entt::meta<base>(context)
+        .conv<&base::get>();
+
+    entt::meta<clazz>(context)
+        .type("bar"_hs)
+        .base<base>();
+
+    for(std::size_t pos{}; pos < reader.size(); ++pos) {
+        reader[pos] = std::thread{[&context, &elem = found[pos]]() {
+            const clazz instance{'c', 2};
+
+            for(std::size_t next{}; next < count; ++next) {
+                const auto any = entt::forward_as_meta(context, instance);
+                elem += static_cast<std::size_t>(any.try_cast<const base>() == &instance);
+                elem += static_cast<std::size_t>(any.allow_cast<char>().cast<char>() == 'c');
+            }
+        }};
+    }
+
+    for(auto &&elem: reader) {
+        elem.join();
+    }
+
+    for(auto &&elem: found) {
+        ASSERT_EQ(elem, 2u * count);
+    }
+}
+
+TEST(MetaMerge, Functionalities) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+    entt::meta_ctx staging{};
+
+    entt::meta<clazz>(context)
+        .type("foo"_hs);
+
+    const auto type = entt::resolve<clazz>(context);
+
+    entt::meta<clazz>(staging)
+        .type("bar"_hs);
+
+    entt::meta<base>(staging)
+        .type("base"_hs)
+        .data<&base::value>("value"_hs);
+
+    entt::meta<argument>(staging)
+        .conv<&argument::get>();
+
+    entt::meta_merge(context, staging);
+
+    ASSERT_EQ(type, entt::resolve(context, "foo"_hs));
+    ASSERT_FALSE(entt::resolve(context, "bar"_hs));
+    ASSERT_TRUE(entt::resolve(context, "base"_hs));
+    ASSERT_TRUE(entt::resolve(context, "base"_hs).data("value"_hs));
+    ASSERT_TRUE(entt::resolve<argument>(context).can_convert(entt::resolve<int>(context)));
+    ASSERT_EQ((std::distance(entt::resolve(context).cbegin(), entt::resolve(context).cend())), 3);
+
+    // types that are already part of the destination keep their identifier
+    ASSERT_FALSE(entt::resolve(staging, "bar"_hs));
+    ASSERT_FALSE(entt::resolve(staging, "base"_hs));
+    ASSERT_EQ(entt::resolve(staging).cbegin(), entt::resolve(staging).cend());
+}
+
+TEST(MetaMerge, ExistingType) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+    entt::meta_ctx staging{};
+    clazz instance{1};
+
+    entt::meta<clazz>(context)
+        .prop("prop"_hs, 1)
+        .data<&clazz::value>("value"_hs)
+        .func<&clazz::func>("func"_hs);
+
+    const auto type = entt::resolve<clazz>(context);
+
+    entt::meta<clazz>(staging)
+        .type("clazz"_hs)
+        .prop("prop"_hs, 2)
+        .prop("other"_hs, 3)
+        .base<base>()
+        .ctor<int>()
+        .data<&base::value>("value"_hs)
+        .func<&clazz::func>("func"_hs)
+        .func<&clazz::cfunc>("func"_hs)
+        .func<&clazz::cfunc>("cfunc"_hs);
+
+    entt::meta<base>(staging)
+        .data<&base::value>("char"_hs);
+
+    entt::meta_merge(context, staging);
+
+    ASSERT_EQ(type, entt::resolve(context, "clazz"_hs));
+    ASSERT_EQ(type.id(), "clazz"_hs);
+    ASSERT_EQ(entt::resolve(staging).cbegin(), entt::resolve(staging).cend());
+
+    // parts of the destination win
+    ASSERT_EQ(type.data("value"_hs).type(), entt::resolve<int>(context));
+    ASSERT_EQ(type.prop("prop"_hs).value().cast<int>(), 1);
+
+    // the others are added to the existing type
+    ASSERT_EQ(type.prop("other"_hs).value().cast<int>(), 3);
+    ASSERT_TRUE(type.func("cfunc"_hs));
+    ASSERT_TRUE(type.data("char"_hs));
+    ASSERT_EQ(type.construct(2).cast<clazz>().value, 2);
+    ASSERT_TRUE(type.can_cast(entt::resolve<base>(context)));
+
+    // overloads are merged as well
+    ASSERT_TRUE(type.func("func"_hs).next());
+    ASSERT_FALSE(type.func("func"_hs).next().next());
+    ASSERT_EQ(type.invoke("func"_hs, instance, 3).cast<int>(), 3);
+    ASSERT_EQ(instance.value, 3);
+}
+
+TEST(MetaMerge, ConcurrentRegistration) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+    argument instance{2};
+    std::array<entt::meta_ctx, 3u> staging{};
+    std::array<std::thread, 3u> writer{};
+
+    writer[0u] = std::thread{[&ctx = staging[0u]]() { entt::meta<clazz>(ctx).type("clazz"_hs).data<&clazz::value>("value"_hs); }};
+    writer[1u] = std::thread{[&ctx = staging[1u]]() { entt::meta<base>(ctx).type("base"_hs).func<&base::get>("get"_hs); }};
+    writer[2u] = std::thread{[&ctx = staging[2u]]() { entt::meta<argument>(ctx).type("argument"_hs).func<&argument::get>("get"_hs); }};
+
+    for(auto &&elem: writer) {
+        elem.join();
+    }
+
+    for(auto &&elem: staging) {
+        entt::meta_merge(context, elem);
+    }
+
+    entt::meta_freeze(context);
+
+    ASSERT_TRUE(entt::resolve(context, "clazz"_hs).data("value"_hs));
+    ASSERT_TRUE(entt::resolve(context, "base"_hs).func("get"_hs));
+    ASSERT_EQ(entt::resolve(context, "argument"_hs).invoke("get"_hs, instance).cast<int>(), 2);
+
+    for(auto &&elem: staging) {
+        ASSERT_EQ(entt::resolve(elem).cbegin(), entt::resolve(elem).cend());
+    }
+}
+
+ENTT_DEBUG_TEST(MetaMergeDeathTest, DuplicateIdentifier) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+    entt::meta_ctx staging{};
+
+    entt::meta<clazz>(context)
+        .type("foo"_hs);
+
+    entt::meta<base>(staging)
+        .type("foo"_hs);
+
+    ASSERT_DEATH(entt::meta_merge(context, staging), "");
+}
+
+ENTT_DEBUG_TEST(MetaFreezeDeathTest, Frozen) {
+    using namespace entt::literals;
+
+    entt::meta_ctx context{};
+
+    entt::meta<clazz>(context)
+        .type("bar"_hs);
+
+    entt::meta_freeze(context);
+
+    ASSERT_DEATH(entt::meta<clazz>(context).type("quux"_hs), "");
+    ASSERT_DEATH(entt::meta_reset<clazz>(context), "");
+    ASSERT_DEATH(entt::meta_reset(context, "bar"_hs), "");
+
+    entt::meta_ctx other{};
+
+    ASSERT_DEATH(entt::meta_merge(context, other), "");
+    ASSERT_DEATH(entt::meta_merge(other, context), "");
+}
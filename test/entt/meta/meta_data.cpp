@@ -683,6 +683,63 @@ TEST_F(MetaData, SetGetFromBase) {
     ASSERT_EQ(instance.value, 1);
 }
 
+TEST_F(MetaData, Address) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<clazz>();
+    const clazz instance{};
+
+    ASSERT_EQ(type.data("i"_hs).address(&instance), &instance.i);
+    ASSERT_EQ(type.data("j"_hs).address(&instance), &instance.j);
+    ASSERT_EQ(type.data("base"_hs).address(&instance), &instance.instance);
+    ASSERT_EQ(type.data("i"_hs).address(nullptr), nullptr);
+    ASSERT_EQ(type.data("h"_hs).address(&instance), nullptr);
+    ASSERT_EQ(entt::resolve<setter_getter>().data("y"_hs).address(&instance), nullptr);
+}
+
+TEST_F(MetaData, Bind) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<clazz>();
+    const auto i = type.data("i"_hs).bind<clazz>();
+    const auto ci = type.data("ci"_hs).bind<const clazz>();
+    const auto h = type.data("h"_hs).bind<void>();
+    clazz instance{};
+
+    ASSERT_FALSE(entt::meta_invoker<clazz>{});
+    ASSERT_TRUE(i);
+    ASSERT_TRUE(ci);
+    ASSERT_TRUE(h);
+
+    i(&instance).cast<int &>() = 3;
+
+    ASSERT_EQ(instance.i, 3);
+    ASSERT_EQ(ci(&std::as_const(instance)).cast<int>(), 3);
+    ASSERT_EQ(ci(&std::as_const(instance)).policy(), entt::meta_any_policy::cref);
+    ASSERT_EQ(h(nullptr).cast<int>(), clazz::h);
+
+    ASSERT_FALSE(type.data("i"_hs).bind<base>());
+    ASSERT_FALSE(type.data("i"_hs).bind<void>());
+    ASSERT_FALSE(entt::resolve<array>().data("local"_hs).bind<array>());
+}
+
+TEST_F(MetaData, BindSetterGetter) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<setter_getter>();
+    const auto x = type.data("x"_hs).bind<const setter_getter>();
+    const auto y = type.data("y"_hs).bind<setter_getter>();
+    const auto cy = type.data("y"_hs).bind<const setter_getter>();
+    setter_getter instance{};
+
+    instance.value = 2;
+
+    ASSERT_EQ(x(&std::as_const(instance)).cast<int>(), 2);
+    ASSERT_EQ(y(&instance).cast<int>(), 2);
+    // non-const getters cannot be invoked on const instances
+    ASSERT_FALSE(cy(&std::as_const(instance)));
+}
+
 TEST_F(MetaData, ReRegistration) {
     using namespace entt::literals;
 
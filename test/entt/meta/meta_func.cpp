@@ -704,6 +704,109 @@ TEST_F(MetaFunc, OverloadedOrder) {
     ASSERT_FALSE(func);
 }
 
+TEST_F(MetaFunc, Bind) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<function>();
+    const auto f2 = type.func("f2"_hs).bind<function, int, int>();
+    const auto f1 = type.func("f1"_hs).bind<const function, int>();
+    function instance{};
+
+    ASSERT_FALSE((entt::meta_invoker<function, int, int>{}));
+    ASSERT_TRUE(f2);
+    ASSERT_TRUE(f1);
+
+    ASSERT_EQ(f2(&instance, 3, 2).cast<int>(), 4);
+    ASSERT_EQ(function::value, 3);
+    ASSERT_EQ(f1(&std::as_const(instance), 3).cast<int>(), 9);
+
+    ASSERT_FALSE((type.func("f2"_hs).bind<function, int>()));
+    ASSERT_FALSE((type.func("f2"_hs).bind<function, int, char>()));
+    ASSERT_FALSE((type.func("f2"_hs).bind<const function, int, int>()));
+    ASSERT_FALSE((type.func("f2"_hs).bind<base, int, int>()));
+    ASSERT_TRUE((type.func("f1"_hs).bind<function, int>()));
+
+    const auto f3 = type.func("f3"_hs).bind<function, base, int, int>();
+
+    ASSERT_TRUE(f3);
+    ASSERT_EQ(f3(&instance, base{}, 4, 3).cast<int>(), 9);
+    ASSERT_EQ(function::value, 4);
+}
+
+TEST_F(MetaFunc, BindStatic) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<function>();
+    const auto k = type.func("k"_hs).bind<void, int>();
+
+    ASSERT_TRUE(k);
+    ASSERT_EQ(k(nullptr, 2).type(), entt::resolve<void>());
+    ASSERT_EQ(function::value, 2);
+
+    // non-const references cannot be bound
+    ASSERT_FALSE((type.func("h"_hs).bind<void, int>()));
+    ASSERT_FALSE((entt::resolve<base>().func("setter"_hs).bind<void, int>()));
+}
+
+TEST_F(MetaFunc, BindExternalMemberFunction) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<base>();
+    const auto setter = type.func("fake_member"_hs).bind<base, int>();
+    const auto getter = type.func("fake_const_member"_hs).bind<const base>();
+    base instance{};
+
+    ASSERT_TRUE(setter);
+    ASSERT_TRUE(getter);
+
+    setter(&instance, 4);
+
+    ASSERT_EQ(instance.value, 4);
+    ASSERT_EQ(getter(&std::as_const(instance)).cast<int>(), 4);
+}
+
+TEST_F(MetaFunc, BindPolicy) {
+    using namespace entt::literals;
+
+    const auto type = entt::resolve<function>();
+    const auto v = type.func("v"_hs).bind<function, int>();
+    const auto a = type.func("a"_hs).bind<function>();
+    function instance{};
+
+    ASSERT_EQ(v(&instance, 4).type(), entt::resolve<void>());
+    ASSERT_EQ(function::value, 4);
+
+    a(&instance).cast<int &>() = 3;
+
+    ASSERT_EQ(function::value, 3);
+}
+
+TEST_F(MetaFunc, BindOverloaded) {
+    using namespace entt::literals;
+
+    entt::meta<function>()
+        .func<entt::overload<int(int) const>(&function::f)>("f2"_hs);
+
+    const auto type = entt::resolve<function>();
+    const auto first = type.func("f2"_hs).bind<function, int, int>();
+    const auto second = type.func("f2"_hs).bind<function, int>();
+    function instance{};
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    ASSERT_EQ(first(&instance, 3, 4).cast<int>(), 16);
+    ASSERT_EQ(second(&instance, 3).cast<int>(), 9);
+    ASSERT_FALSE((type.func("f2"_hs).next().bind<function, int, int>()));
+}
+
+ENTT_DEBUG_TEST_F(MetaFuncDeathTest, Bind) {
+    const entt::meta_invoker<function, int> invoker{};
+    function instance{};
+
+    ASSERT_DEATH([[maybe_unused]] auto any = invoker(&instance, 0), "");
+}
+
 TEST_F(MetaFunc, ReRegistration) {
     using namespace entt::literals;
 
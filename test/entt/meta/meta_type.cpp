@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <gtest/gtest.h>
@@ -205,7 +206,30 @@ TEST_F(MetaType, Resolve) {
     ASSERT_TRUE(found);
 }
 
+TEST_F(MetaType, StableNode) {
+    using namespace entt::literals;
+
+    struct local_type {};
+
+    const auto type = entt::resolve<clazz>();
+    const auto other = entt::resolve<local_type>();
+
+    // registering new types doesn't invalidate existing ones
+    entt::meta<local_type>().type("local"_hs);
+    entt::meta<char>().type("char"_hs);
+
+    ASSERT_EQ(type, entt::resolve("class"_hs));
+    ASSERT_EQ(type.id(), "class"_hs);
+    ASSERT_TRUE(type.data("value"_hs));
+
+    ASSERT_EQ(other, entt::resolve<local_type>());
+    ASSERT_NE(other.id(), "local"_hs);
+    ASSERT_EQ(entt::resolve<local_type>().id(), "local"_hs);
+}
+
 TEST_F(MetaType, Functionalities) {
+    static_assert(std::is_trivially_copyable_v<entt::meta_type>, "Trivially copyable type required");
+
     using namespace entt::literals;
 
     auto type = entt::resolve<clazz>();
@@ -266,6 +290,10 @@ TEST_F(MetaType, Traits) {
     ASSERT_TRUE(entt::resolve<int *>().is_pointer());
     ASSERT_FALSE(entt::resolve<int>().is_pointer());
 
+    ASSERT_TRUE(entt::resolve<int>().is_trivially_copyable());
+    ASSERT_TRUE(entt::resolve<property_type>().is_trivially_copyable());
+    ASSERT_FALSE(entt::resolve<std::vector<int>>().is_trivially_copyable());
+
     ASSERT_TRUE(entt::resolve<int *>().is_pointer_like());
     ASSERT_TRUE(entt::resolve<std::shared_ptr<int>>().is_pointer_like());
     ASSERT_FALSE(entt::resolve<int>().is_pointer_like());
@@ -399,6 +427,41 @@ TEST_F(MetaType, Data) {
     ASSERT_EQ(type.data().cbegin(), type.data().cend());
 }
 
+TEST_F(MetaType, ManyData) {
+    using namespace entt::literals;
+
+    constexpr entt::id_type count = 64u;
+    auto factory = entt::meta<clazz>();
+
+    for(entt::id_type next{}; next < count; ++next) {
+        // ids sharing their lower bits collide within the lookup table
+        factory.data<&clazz::value>(next * count);
+    }
+
+    // re-registration doesn't add elements
+    factory.data<&clazz::value>(count);
+
+    const auto type = entt::resolve<clazz>();
+    entt::id_type expected{};
+
+    for(auto &&curr: type.data()) {
+        if(curr.first != "value"_hs) {
+            // elements are returned in order of registration
+            ASSERT_EQ(curr.first, expected * count);
+            ++expected;
+        }
+    }
+
+    ASSERT_EQ(expected, count);
+
+    for(entt::id_type next{}; next < count; ++next) {
+        ASSERT_TRUE(type.data(next * count));
+        ASSERT_FALSE(type.data(next * count + 1u));
+    }
+
+    ASSERT_TRUE(type.data("value"_hs));
+}
+
 TEST_F(MetaType, Func) {
     using namespace entt::literals;
 
@@ -857,6 +920,30 @@ TEST_F(MetaType, NameCollision) {
     ASSERT_TRUE(entt::resolve("quux"_hs));
 }
 
+TEST_F(MetaType, ResolveById) {
+    using namespace entt::literals;
+
+    entt::meta<unsigned int>().type(entt::type_hash<unsigned int>::value());
+
+    ASSERT_EQ(entt::resolve(entt::type_hash<unsigned int>::value()), entt::resolve<unsigned int>());
+
+    entt::meta<unsigned int>().type("uint"_hs);
+
+    ASSERT_FALSE(entt::resolve(entt::type_hash<unsigned int>::value()));
+    ASSERT_EQ(entt::resolve("uint"_hs), entt::resolve<unsigned int>());
+
+    entt::meta<unsigned int>().type(entt::type_hash<unsigned int>::value());
+
+    ASSERT_FALSE(entt::resolve("uint"_hs));
+    ASSERT_EQ(entt::resolve(entt::type_hash<unsigned int>::value()), entt::resolve<unsigned int>());
+
+    entt::meta<unsigned int>().type("uint"_hs);
+    entt::meta_reset<unsigned int>();
+
+    ASSERT_FALSE(entt::resolve("uint"_hs));
+    ASSERT_FALSE(entt::resolve(entt::type_hash<unsigned int>::value()));
+}
+
 ENTT_DEBUG_TEST_F(MetaTypeDeathTest, NameCollision) {
     using namespace entt::literals;
 
@@ -1,4 +1,7 @@
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <thread>
 #include <utility>
 #include <gtest/gtest.h>
 #include <entt/core/hashed_string.hpp>
@@ -10,6 +13,122 @@ struct non_aggregate {
     non_aggregate(int) {}
 };
 
+struct concurrent_event {
+    static constexpr auto concurrent_queue = true;
+    int value{};
+};
+
+struct concurrent_non_aggregate {
+    static constexpr auto concurrent_queue = true;
+
+    concurrent_non_aggregate(int elem)
+        : value{elem} {}
+
+    int value;
+};
+
+struct keyed_event {
+    int key{};
+    int value{};
+};
+
+struct replaced_event {
+    int key{};
+    int value{};
+};
+
+template<>
+struct entt::event_traits<keyed_event> {
+    using type = keyed_event;
+
+    static int key(const keyed_event &event) {
+        return event.key;
+    }
+
+    static void merge(keyed_event &pending, keyed_event &&incoming) {
+        pending.value += incoming.value;
+    }
+};
+
+template<>
+struct entt::event_traits<replaced_event> {
+    using type = replaced_event;
+
+    static int key(const replaced_event &event) {
+        return event.key;
+    }
+};
+
+struct keyed_receiver {
+    void receive(const keyed_event &event) {
+        sum += event.value * (event.key + 1);
+        ++cnt;
+    }
+
+    void replace(const replaced_event &event) {
+        sum += event.value;
+        ++cnt;
+    }
+
+    void forward(const keyed_event &event) {
+        dispatcher->enqueue<keyed_event>(event.key, 1);
+    }
+
+    entt::dispatcher *dispatcher{};
+    std::size_t cnt{};
+    int sum{};
+};
+
+template<typename Type>
+struct counting_allocator {
+    using value_type = Type;
+
+    counting_allocator(std::size_t *value) noexcept
+        : counter{value} {}
+
+    template<typename Other>
+    counting_allocator(const counting_allocator<Other> &other) noexcept
+        : counter{other.counter} {}
+
+    Type *allocate(const std::size_t length) {
+        ++*counter;
+        return std::allocator<Type>{}.allocate(length);
+    }
+
+    void deallocate(Type *value, const std::size_t length) noexcept {
+        std::allocator<Type>{}.deallocate(value, length);
+    }
+
+    template<typename Other>
+    bool operator==(const counting_allocator<Other> &other) const noexcept {
+        return counter == other.counter;
+    }
+
+    template<typename Other>
+    bool operator!=(const counting_allocator<Other> &other) const noexcept {
+        return counter != other.counter;
+    }
+
+    std::size_t *counter;
+};
+
+struct concurrent_receiver {
+    void receive(const concurrent_event &event) {
+        sum += event.value;
+        ++cnt;
+    }
+
+    void forward(const concurrent_event &event) {
+        if(event.value != 0) {
+            dispatcher->enqueue<concurrent_event>(0);
+        }
+    }
+
+    entt::dispatcher *dispatcher{};
+    std::size_t cnt{};
+    int sum{};
+};
+
 struct receiver {
     static void forward(entt::dispatcher &dispatcher, test::empty &event) {
         dispatcher.enqueue(event);
@@ -134,6 +253,194 @@ TEST(Dispatcher, StopAndGo) {
     ASSERT_EQ(receiver.cnt, 2);
 }
 
+TEST(Dispatcher, Budget) {
+    entt::dispatcher dispatcher{};
+    receiver receiver{};
+
+    dispatcher.sink<test::empty>().connect<&receiver::receive>(receiver);
+
+    for(std::size_t pos{}; pos < 5u; ++pos) {
+        dispatcher.enqueue<test::empty>();
+    }
+
+    dispatcher.enqueue<int>(3);
+
+    ASSERT_EQ(dispatcher.update(2u), 2u);
+    ASSERT_EQ(receiver.cnt, 2);
+    ASSERT_EQ(dispatcher.size<test::empty>(), 3u);
+    ASSERT_EQ(dispatcher.size<int>(), 1u);
+
+    ASSERT_EQ(dispatcher.update(3u), 3u);
+    ASSERT_EQ(receiver.cnt, 5);
+    ASSERT_EQ(dispatcher.size<test::empty>(), 0u);
+    ASSERT_EQ(dispatcher.size<int>(), 1u);
+
+    dispatcher.enqueue<test::empty>();
+
+    ASSERT_EQ(dispatcher.update(4u), 2u);
+    ASSERT_EQ(receiver.cnt, 6);
+    ASSERT_EQ(dispatcher.size(), 0u);
+    ASSERT_EQ(dispatcher.update(4u), 0u);
+}
+
+TEST(Dispatcher, Priority) {
+    using namespace entt::literals;
+
+    entt::dispatcher dispatcher{};
+    receiver receiver{};
+
+    dispatcher.sink<test::empty>().connect<&receiver::receive>(receiver);
+    dispatcher.sink<test::empty>("named"_hs).connect<&receiver::reset>(receiver);
+
+    ASSERT_EQ(dispatcher.priority<test::empty>(), 0);
+    ASSERT_EQ(dispatcher.priority<int>(), 0);
+
+    dispatcher.enqueue<test::empty>();
+    dispatcher.enqueue_hint<test::empty>("named"_hs);
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 0);
+
+    dispatcher.prioritize<test::empty>(1);
+
+    ASSERT_EQ(dispatcher.priority<test::empty>(), 1);
+    ASSERT_EQ(dispatcher.priority<test::empty>("named"_hs), 0);
+
+    dispatcher.enqueue<test::empty>();
+    dispatcher.enqueue_hint<test::empty>("named"_hs);
+
+    ASSERT_EQ(dispatcher.update(1u), 1u);
+    ASSERT_EQ(receiver.cnt, 1);
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 0);
+
+    dispatcher.prioritize<test::empty>(2, "named"_hs);
+    dispatcher.enqueue<test::empty>();
+    dispatcher.enqueue_hint<test::empty>("named"_hs);
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 1);
+}
+
+TEST(Dispatcher, PriorityOnUpdate) {
+    entt::dispatcher dispatcher{};
+    int count{};
+
+    dispatcher.sink<test::empty>().connect([&dispatcher, &count](const test::empty &) {
+        if(++count == 1) {
+            dispatcher.sink<int>().connect([&count](const int &) { count += 10; });
+            dispatcher.enqueue<int>(0);
+            dispatcher.enqueue<test::empty>();
+            dispatcher.prioritize<test::empty>(-2);
+        }
+    });
+
+    dispatcher.prioritize<test::empty>(-1);
+    dispatcher.enqueue<test::empty>();
+    dispatcher.update();
+
+    ASSERT_EQ(count, 11);
+    ASSERT_EQ(dispatcher.priority<test::empty>(), -2);
+    ASSERT_EQ(dispatcher.size<test::empty>(), 1u);
+
+    dispatcher.enqueue<int>(0);
+
+    ASSERT_EQ(dispatcher.update(1u), 1u);
+    ASSERT_EQ(count, 21);
+    ASSERT_EQ(dispatcher.size<test::empty>(), 1u);
+}
+
+TEST(Dispatcher, UpdateParallel) {
+    entt::dispatcher dispatcher{};
+    receiver serial{};
+    receiver parallel{};
+    std::size_t tasks{};
+
+    dispatcher.sink<test::empty>().connect<&receiver::receive>(serial);
+    dispatcher.sink<test::empty>().connect_parallel<&receiver::receive>(parallel);
+
+    dispatcher.enqueue<test::empty>();
+    dispatcher.enqueue<test::empty>();
+
+    dispatcher.update_parallel<test::empty>([&tasks](const std::size_t count, auto task) {
+        std::thread worker{[count, &task]() {
+            for(std::size_t pos{}; pos < count; ++pos) {
+                task(pos);
+            }
+        }};
+
+        tasks += count;
+        worker.join();
+    });
+
+    ASSERT_EQ(tasks, 1u);
+    ASSERT_EQ(serial.cnt, 2);
+    ASSERT_EQ(parallel.cnt, 2);
+    ASSERT_EQ(dispatcher.size<test::empty>(), 0u);
+}
+
+TEST(Dispatcher, Coalesce) {
+    entt::dispatcher dispatcher{};
+    keyed_receiver receiver{&dispatcher};
+
+    dispatcher.sink<keyed_event>().connect<&keyed_receiver::receive>(receiver);
+    dispatcher.sink<replaced_event>().connect<&keyed_receiver::replace>(receiver);
+
+    dispatcher.enqueue<keyed_event>(0, 1);
+    dispatcher.enqueue<keyed_event>(1, 2);
+    dispatcher.enqueue(keyed_event{0, 3});
+    dispatcher.enqueue<keyed_event>(1, 4);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 2u);
+
+    dispatcher.update<keyed_event>();
+
+    ASSERT_EQ(receiver.cnt, 2u);
+    ASSERT_EQ(receiver.sum, 4 + 6 * 2);
+
+    receiver = keyed_receiver{&dispatcher};
+    dispatcher.enqueue<replaced_event>(0, 1);
+    dispatcher.enqueue<replaced_event>(0, 2);
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 1u);
+    ASSERT_EQ(receiver.sum, 2);
+}
+
+TEST(Dispatcher, CoalesceBudget) {
+    entt::dispatcher dispatcher{};
+    keyed_receiver receiver{&dispatcher};
+
+    dispatcher.sink<keyed_event>().connect<&keyed_receiver::receive>(receiver);
+
+    for(int key{}; key < 4; ++key) {
+        dispatcher.enqueue<keyed_event>(key, 1);
+    }
+
+    ASSERT_EQ(dispatcher.update(3u), 3u);
+
+    dispatcher.enqueue<keyed_event>(0, 1);
+    dispatcher.enqueue<keyed_event>(3, 1);
+    dispatcher.enqueue<keyed_event>(0, 1);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 2u);
+
+    dispatcher.sink<keyed_event>().connect<&keyed_receiver::forward>(receiver);
+    receiver = keyed_receiver{&dispatcher};
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 2u);
+    ASSERT_EQ(receiver.sum, 2 * 4 + 2 * 1);
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 2u);
+
+    dispatcher.clear<keyed_event>();
+    dispatcher.enqueue<keyed_event>(0, 1);
+
+    ASSERT_EQ(dispatcher.size<keyed_event>(), 1u);
+}
+
 TEST(Dispatcher, OpaqueDisconnect) {
     entt::dispatcher dispatcher{};
     receiver receiver{};
@@ -149,6 +456,26 @@ TEST(Dispatcher, OpaqueDisconnect) {
     ASSERT_EQ(receiver.cnt, 1);
 }
 
+TEST(Dispatcher, OwningListener) {
+    entt::dispatcher dispatcher{};
+    int counter{};
+
+    {
+        const int step = 2;
+        dispatcher.sink<test::empty>().connect([&counter, step](test::empty &) { counter += step; });
+    }
+
+    dispatcher.enqueue<test::empty>();
+    dispatcher.update();
+
+    ASSERT_EQ(counter, 2);
+
+    dispatcher.sink<test::empty>().disconnect();
+    dispatcher.trigger<test::empty>();
+
+    ASSERT_EQ(counter, 2);
+}
+
 TEST(Dispatcher, NamedQueue) {
     using namespace entt::literals;
 
@@ -184,6 +511,107 @@ TEST(Dispatcher, NamedQueue) {
     ASSERT_EQ(receiver.cnt, 3);
 }
 
+TEST(Dispatcher, ConcurrentQueue) {
+    static_assert(entt::event_traits<concurrent_event>::concurrent_queue, "Concurrent queue required");
+    static_assert(!entt::event_traits<test::empty>::concurrent_queue, "Concurrent queue not allowed");
+
+    entt::dispatcher dispatcher{};
+    concurrent_receiver receiver{&dispatcher};
+
+    dispatcher.sink<concurrent_event>().connect<&concurrent_receiver::receive>(receiver);
+    dispatcher.sink<concurrent_event>().connect<&concurrent_receiver::forward>(receiver);
+    dispatcher.trigger(concurrent_event{1});
+
+    ASSERT_EQ(receiver.cnt, 1u);
+    ASSERT_EQ(dispatcher.size<concurrent_event>(), 1u);
+
+    dispatcher.enqueue<concurrent_event>(2);
+    dispatcher.enqueue(concurrent_event{3});
+
+    ASSERT_EQ(dispatcher.size<concurrent_event>(), 3u);
+    ASSERT_EQ(dispatcher.size(), 3u);
+
+    dispatcher.update<concurrent_event>();
+
+    ASSERT_EQ(receiver.cnt, 4u);
+    ASSERT_EQ(receiver.sum, 6);
+    ASSERT_EQ(dispatcher.size<concurrent_event>(), 2u);
+
+    dispatcher.clear<concurrent_event>();
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 4u);
+    ASSERT_EQ(dispatcher.size(), 0u);
+
+    dispatcher.enqueue<concurrent_non_aggregate>(1);
+    dispatcher.enqueue<concurrent_event>();
+
+    ASSERT_EQ(dispatcher.size<concurrent_non_aggregate>(), 1u);
+    ASSERT_EQ(dispatcher.size(), 2u);
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 5u);
+    ASSERT_EQ(dispatcher.size(), 0u);
+
+    dispatcher.enqueue<concurrent_non_aggregate>(2);
+}
+
+TEST(Dispatcher, ConcurrentProducers) {
+    constexpr int count = 1000;
+    entt::dispatcher dispatcher{};
+    concurrent_receiver receiver{};
+    std::array<std::thread, 4u> producer{};
+
+    dispatcher.sink<concurrent_event>().connect<&concurrent_receiver::receive>(receiver);
+
+    for(auto &&elem: producer) {
+        elem = std::thread{[&dispatcher]() {
+            for(int next{}; next < count; ++next) {
+                dispatcher.enqueue<concurrent_event>(1);
+            }
+        }};
+    }
+
+    while(receiver.cnt < producer.size() * count) {
+        dispatcher.update();
+    }
+
+    for(auto &&elem: producer) {
+        elem.join();
+    }
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, producer.size() * count);
+    ASSERT_EQ(receiver.sum, static_cast<int>(producer.size()) * count);
+    ASSERT_EQ(dispatcher.size(), 0u);
+}
+
+TEST(Dispatcher, ConcurrentQueueRecycling) {
+    std::size_t counter{};
+    entt::basic_dispatcher<counting_allocator<void>> dispatcher{counting_allocator<void>{&counter}};
+    concurrent_receiver receiver{};
+
+    dispatcher.sink<concurrent_event>().connect<&concurrent_receiver::receive>(receiver);
+
+    for(int next{}; next < 8; ++next) {
+        dispatcher.enqueue<concurrent_event>(1);
+    }
+
+    dispatcher.update();
+    counter = 0u;
+
+    for(int next{}; next < 4; ++next) {
+        dispatcher.enqueue<concurrent_event>(1);
+    }
+
+    dispatcher.update();
+
+    ASSERT_EQ(receiver.cnt, 12u);
+    ASSERT_EQ(counter, 0u);
+}
+
 TEST(Dispatcher, CustomAllocator) {
     const std::allocator<void> allocator{};
     entt::dispatcher dispatcher{allocator};
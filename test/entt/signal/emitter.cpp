@@ -1,4 +1,3 @@
-#include <functional>
 #include <memory>
 #include <utility>
 #include <gtest/gtest.h>
@@ -137,19 +136,55 @@ TEST(Emitter, On) {
     ASSERT_EQ(value, 1);
 }
 
+TEST(Emitter, OnAfterMove) {
+    test::emitter emitter{};
+    const test::emitter *owner{};
+
+    emitter.on<test::boxed_int>([&owner](auto &, const auto &elem) {
+        owner = &elem;
+    });
+
+    test::emitter other{std::move(emitter)};
+    other.publish(test::boxed_int{});
+
+    ASSERT_EQ(owner, &other);
+
+    other.erase<test::boxed_int>();
+    other.erase<test::boxed_int>();
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_FALSE(other.contains<test::boxed_int>());
+}
+
 TEST(Emitter, OnAndErase) {
     test::emitter emitter{};
-    const std::function<void(test::empty &, test::emitter &)> func{};
+    int value{};
 
-    emitter.on(func);
+    emitter.on<test::empty>([&value](const auto &, const auto &) { value += 1; });
+    emitter.on<test::boxed_int>([&value](const auto &event, const auto &) { value += event.value; });
+    emitter.on<test::boxed_char>([&value](const auto &, const auto &) { value += 2; });
 
     ASSERT_FALSE(emitter.empty());
     ASSERT_TRUE(emitter.contains<test::empty>());
 
     emitter.erase<test::empty>();
 
-    ASSERT_TRUE(emitter.empty());
+    ASSERT_FALSE(emitter.empty());
     ASSERT_FALSE(emitter.contains<test::empty>());
+    ASSERT_TRUE(emitter.contains<test::boxed_int>());
+    ASSERT_TRUE(emitter.contains<test::boxed_char>());
+
+    emitter.publish(test::empty{});
+    emitter.publish(test::boxed_int{4});
+    emitter.publish(test::boxed_char{'c'});
+
+    ASSERT_EQ(value, 6);
+
+    emitter.erase<test::boxed_char>();
+    emitter.erase<test::boxed_int>();
+
+    ASSERT_TRUE(emitter.empty());
+    ASSERT_FALSE(emitter.contains<test::boxed_int>());
 }
 
 TEST(Emitter, CustomAllocator) {
@@ -0,0 +1,155 @@
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/signal/inplace_delegate.hpp>
+#include <entt/signal/sigh.hpp>
+#include "../../common/config.h"
+
+int power_of_two(const int &i) {
+    return i * i;
+}
+
+struct inplace_delegate_functor {
+    [[nodiscard]] int identity(int i) const {
+        return i;
+    }
+};
+
+struct counter {
+    counter(int &ref)
+        : value{&ref} {}
+
+    counter(counter &&other) noexcept
+        : value{std::exchange(other.value, nullptr)} {}
+
+    ~counter() {
+        if(value) {
+            ++*value;
+        }
+    }
+
+    counter &operator=(counter &&) = delete;
+
+    int operator()(int i) const {
+        return i;
+    }
+
+    int *value;
+};
+
+TEST(InplaceDelegate, Functionalities) {
+    static_assert(!std::is_copy_constructible_v<entt::inplace_delegate<int(int)>>, "Copy constructible type not allowed");
+    static_assert(std::is_nothrow_move_constructible_v<entt::inplace_delegate<int(int)>>, "Nothrow move constructible type required");
+
+    entt::inplace_delegate<int(int)> func{};
+
+    ASSERT_FALSE(func);
+
+    const int value = 3;
+    func.emplace([value](int i) { return i * value; });
+
+    ASSERT_TRUE(func);
+    ASSERT_EQ(func(2), 6);
+
+    func = [](int i) { return i + 1; };
+
+    ASSERT_TRUE(func);
+    ASSERT_EQ(func(2), 3);
+
+    func.reset();
+
+    ASSERT_FALSE(func);
+}
+
+TEST(InplaceDelegate, Mutable) {
+    entt::inplace_delegate<int()> func{[curr = 0]() mutable { return ++curr; }};
+
+    ASSERT_EQ(func(), 1);
+    ASSERT_EQ(func(), 2);
+
+    auto other = std::move(func);
+
+    ASSERT_FALSE(func);
+    ASSERT_EQ(other(), 3);
+}
+
+TEST(InplaceDelegate, ConnectArg) {
+    inplace_delegate_functor instance{};
+    const entt::inplace_delegate<int(int)> func{entt::connect_arg<&power_of_two>};
+    const entt::inplace_delegate<int(int)> other{entt::connect_arg<&inplace_delegate_functor::identity>, instance};
+
+    ASSERT_EQ(func(3), 9);
+    ASSERT_EQ(other(3), 3);
+}
+
+TEST(InplaceDelegate, NonTrivialType) {
+    int destroyed{};
+
+    {
+        entt::inplace_delegate<int(int)> func{counter{destroyed}};
+
+        ASSERT_EQ(destroyed, 0);
+        ASSERT_EQ(func(4), 4);
+
+        entt::inplace_delegate<int(int)> other{std::move(func)};
+
+        ASSERT_FALSE(func);
+        ASSERT_EQ(other(2), 2);
+        ASSERT_EQ(destroyed, 0);
+
+        other = entt::inplace_delegate<int(int)>{};
+
+        ASSERT_FALSE(other);
+        ASSERT_EQ(destroyed, 1);
+
+        other.emplace(counter{destroyed});
+    }
+
+    ASSERT_EQ(destroyed, 2);
+}
+
+TEST(InplaceDelegate, MoveOnlyCapture) {
+    entt::inplace_delegate<int()> func{[ptr = std::make_unique<int>(4)]() { return *ptr; }};
+    entt::inplace_delegate<int()> other{};
+
+    other = std::move(func);
+
+    ASSERT_FALSE(func);
+    ASSERT_EQ(other(), 4);
+}
+
+TEST(InplaceDelegate, CustomLength) {
+    const int first = 1;
+    const int second = 2;
+    const int third = 3;
+
+    const entt::inplace_delegate<int(), sizeof(int) * 3u> func{[first, second, third]() { return first + second + third; }};
+
+    ASSERT_EQ(func(), 6);
+}
+
+TEST(InplaceDelegate, Sigh) {
+    using closure_type = entt::inplace_delegate<void(int)>;
+
+    entt::sigh<void(int)> sigh{};
+    entt::sink sink{sigh};
+    int value{};
+
+    closure_type func{[&value](int i) { value += i; }};
+    sink.connect<&closure_type::operator()>(func);
+    sigh.publish(2);
+
+    ASSERT_EQ(value, 2);
+
+    sink.disconnect<&closure_type::operator()>(func);
+    sigh.publish(2);
+
+    ASSERT_EQ(value, 2);
+}
+
+ENTT_DEBUG_TEST(InplaceDelegateDeathTest, InvokeEmpty) {
+    const entt::inplace_delegate<int(int)> func{};
+
+    ASSERT_DEATH([[maybe_unused]] const auto value = func(4), "");
+}
@@ -0,0 +1,302 @@
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <gtest/gtest.h>
+#include <entt/core/hashed_string.hpp>
+#include <entt/signal/dispatcher.hpp>
+#include <entt/signal/mailbox.hpp>
+#include "../../common/config.h"
+#include "../../common/empty.h"
+
+struct message {
+    std::size_t from{};
+    int value{};
+};
+
+// makes the type non-aggregate
+struct non_aggregate {
+    non_aggregate(int elem)
+        : value{elem} {}
+
+    int value;
+};
+
+template<typename Type>
+struct counting_allocator {
+    using value_type = Type;
+
+    counting_allocator(std::size_t *value) noexcept
+        : counter{value} {}
+
+    template<typename Other>
+    counting_allocator(const counting_allocator<Other> &other) noexcept
+        : counter{other.counter} {}
+
+    Type *allocate(const std::size_t length) {
+        ++*counter;
+        return std::allocator<Type>{}.allocate(length);
+    }
+
+    void deallocate(Type *value, const std::size_t length) noexcept {
+        std::allocator<Type>{}.deallocate(value, length);
+    }
+
+    template<typename Other>
+    bool operator==(const counting_allocator<Other> &other) const noexcept {
+        return counter == other.counter;
+    }
+
+    template<typename Other>
+    bool operator!=(const counting_allocator<Other> &other) const noexcept {
+        return counter != other.counter;
+    }
+
+    std::size_t *counter;
+};
+
+struct actor {
+    void receive(const message &event) {
+        sum += event.value;
+        ++cnt;
+    }
+
+    void reply(const message &event) {
+        mailbox->enqueue_to<message>(event.from, self, event.value);
+    }
+
+    void count(const non_aggregate &event) {
+        sum += event.value;
+    }
+
+    entt::mailbox *mailbox{};
+    std::size_t self{};
+    std::size_t cnt{};
+    int sum{};
+};
+
+TEST(Mailbox, Constructors) {
+    static_assert(!std::is_copy_constructible_v<entt::mailbox>, "Copy constructible type not allowed");
+    static_assert(std::is_nothrow_move_constructible_v<entt::mailbox>, "Nothrow move constructible type required");
+
+    entt::mailbox mailbox{3u};
+
+    ASSERT_EQ(mailbox.consumers(), 3u);
+    ASSERT_EQ(mailbox.size(0u), 0u);
+
+    mailbox.enqueue_to<message>(1u, 0u, 1);
+    entt::mailbox other{std::move(mailbox)};
+
+    ASSERT_EQ(other.consumers(), 3u);
+    ASSERT_EQ(other.size(1u), 1u);
+}
+
+TEST(Mailbox, Functionalities) {
+    entt::mailbox mailbox{2u};
+    std::array<actor, 2u> instance{};
+
+    mailbox.sink<message>(0u).connect<&actor::receive>(instance[0u]);
+    mailbox.sink<message>(1u).connect<&actor::receive>(instance[1u]);
+    mailbox.sink<non_aggregate>(1u).connect<&actor::count>(instance[1u]);
+
+    mailbox.enqueue_to<message>(1u, 0u, 2);
+    mailbox.enqueue_to(1u, message{0u, 3});
+    mailbox.enqueue_to<non_aggregate>(1u, 4);
+
+    ASSERT_EQ(mailbox.size(0u), 0u);
+    ASSERT_EQ(mailbox.size(1u), 3u);
+
+    mailbox.update(0u);
+
+    ASSERT_EQ(instance[0u].cnt, 0u);
+    ASSERT_EQ(mailbox.size(1u), 3u);
+
+    mailbox.update(1u);
+
+    ASSERT_EQ(instance[1u].cnt, 2u);
+    ASSERT_EQ(instance[1u].sum, 9);
+    ASSERT_EQ(mailbox.size(1u), 0u);
+
+    mailbox.trigger(0u, message{1u, 1});
+
+    ASSERT_EQ(instance[0u].cnt, 1u);
+    ASSERT_EQ(instance[1u].cnt, 2u);
+
+    mailbox.enqueue_to<message>(0u, 1u, 1);
+    mailbox.clear(0u);
+    mailbox.update(0u);
+
+    ASSERT_EQ(instance[0u].cnt, 1u);
+    ASSERT_EQ(mailbox.size(0u), 0u);
+}
+
+TEST(Mailbox, Dispatcher) {
+    using namespace entt::literals;
+
+    entt::mailbox mailbox{1u};
+    entt::dispatcher &dispatcher = mailbox[0u];
+    actor instance{};
+
+    dispatcher.sink<message>("named"_hs).connect<&actor::receive>(instance);
+    dispatcher.sink<message>().connect<&actor::receive>(instance);
+
+    mailbox.enqueue_to<message>(0u, 0u, 1);
+    dispatcher.enqueue_hint<message>("named"_hs, 0u, 2);
+
+    ASSERT_EQ(mailbox.size(0u), 2u);
+
+    mailbox.update(0u);
+
+    ASSERT_EQ(instance.cnt, 2u);
+    ASSERT_EQ(instance.sum, 3);
+}
+
+TEST(Mailbox, Budget) {
+    entt::mailbox mailbox{1u};
+    actor instance{};
+
+    mailbox.sink<message>(0u).connect<&actor::receive>(instance);
+
+    for(int next{}; next < 4; ++next) {
+        mailbox.enqueue_to<message>(0u, 0u, next);
+    }
+
+    ASSERT_EQ(mailbox.update(0u, 3u), 3u);
+    ASSERT_EQ(instance.cnt, 3u);
+    ASSERT_EQ(mailbox.size(0u), 1u);
+
+    ASSERT_EQ(mailbox.update(0u, 3u), 1u);
+    ASSERT_EQ(instance.cnt, 4u);
+    ASSERT_EQ(mailbox.size(0u), 0u);
+}
+
+TEST(Mailbox, Consumers) {
+    constexpr int count = 1000;
+    entt::mailbox mailbox{3u};
+    std::array<actor, 3u> instance{};
+    std::array<std::thread, 2u> consumer{};
+
+    for(std::size_t pos{}; pos < instance.size(); ++pos) {
+        instance[pos].mailbox = &mailbox;
+        instance[pos].self = pos;
+    }
+
+    // the last consumer is the main thread
+    mailbox.sink<message>(2u).connect<&actor::receive>(instance[2u]);
+
+    for(std::size_t pos{}; pos < consumer.size(); ++pos) {
+        mailbox.sink<message>(pos).connect<&actor::reply>(instance[pos]);
+        mailbox.sink<message>(pos).connect<&actor::receive>(instance[pos]);
+
+        consumer[pos] = std::thread{[&mailbox, &elem = instance[pos], pos]() {
+            while(elem.cnt < count) {
+                mailbox.update(pos);
+            }
+        }};
+    }
+
+    for(int next{}; next < count; ++next) {
+        mailbox.enqueue_to<message>(0u, 2u, 1);
+        mailbox.enqueue_to<message>(1u, 2u, 2);
+    }
+
+    while(instance[2u].cnt < 2u * count) {
+        mailbox.update(2u);
+    }
+
+    for(auto &&elem: consumer) {
+        elem.join();
+    }
+
+    ASSERT_EQ(instance[0u].cnt, count);
+    ASSERT_EQ(instance[1u].cnt, count);
+    ASSERT_EQ(instance[0u].sum, count);
+    ASSERT_EQ(instance[1u].sum, 2 * count);
+    ASSERT_EQ(instance[2u].sum, 3 * count);
+    ASSERT_EQ(mailbox.size(2u), 0u);
+}
+
+TEST(Mailbox, Pending) {
+    int destroyed{};
+
+    struct tracked {
+        tracked(int &ref)
+            : value{&ref} {}
+
+        tracked(tracked &&other) noexcept
+            : value{std::exchange(other.value, nullptr)} {}
+
+        ~tracked() {
+            if(value) {
+                ++*value;
+            }
+        }
+
+        tracked &operator=(tracked &&other) noexcept {
+            std::swap(value, other.value);
+            return *this;
+        }
+
+        int *value;
+    };
+
+    {
+        entt::mailbox mailbox{1u};
+        mailbox.enqueue_to<tracked>(0u, destroyed);
+        mailbox.enqueue_to<tracked>(0u, destroyed);
+
+        ASSERT_EQ(destroyed, 0);
+    }
+
+    ASSERT_EQ(destroyed, 2);
+}
+
+TEST(Mailbox, Recycling) {
+    std::size_t counter{};
+    entt::basic_mailbox<counting_allocator<void>> mailbox{1u, counting_allocator<void>{&counter}};
+    actor receiver{};
+
+    mailbox.sink<message>(0u).connect<&actor::receive>(receiver);
+
+    for(int next{}; next < 8; ++next) {
+        mailbox.enqueue_to<message>(0u, 0u, 1);
+    }
+
+    mailbox.update(0u);
+    counter = 0u;
+
+    for(int next{}; next < 4; ++next) {
+        mailbox.enqueue_to<message>(0u, 0u, 1);
+    }
+
+    mailbox.update(0u);
+
+    ASSERT_EQ(receiver.cnt, 12u);
+    ASSERT_EQ(receiver.sum, 12);
+    ASSERT_EQ(counter, 0u);
+
+    // events that don't fit a node of the pool are allocated as they are
+    mailbox.enqueue_to(0u, std::array<int, 32u>{});
+
+    ASSERT_NE(counter, 0u);
+    ASSERT_EQ(mailbox.size(0u), 1u);
+}
+
+TEST(Mailbox, CustomAllocator) {
+    const std::allocator<void> allocator{};
+    entt::mailbox mailbox{1u, allocator};
+
+    ASSERT_EQ(mailbox.get_allocator(), allocator);
+    ASSERT_FALSE(mailbox.get_allocator() != allocator);
+    ASSERT_EQ(mailbox[0u].get_allocator(), allocator);
+}
+
+ENTT_DEBUG_TEST(MailboxDeathTest, InvalidConsumer) {
+    entt::mailbox mailbox{1u};
+
+    ASSERT_DEATH(mailbox.enqueue_to<message>(1u), "");
+    ASSERT_DEATH(mailbox.update(1u), "");
+    ASSERT_DEATH([[maybe_unused]] auto &elem = mailbox[1u], "");
+}
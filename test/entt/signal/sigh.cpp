@@ -1,5 +1,10 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include <entt/signal/sigh.hpp>
 #include "../../common/linter.hpp"
@@ -52,6 +57,14 @@ void connect_and_auto_disconnect(entt::sigh<void(int &)> &sigh, const int &) {
     sink.disconnect<&connect_and_auto_disconnect>(sigh);
 }
 
+void disconnect_all(entt::sigh<void(int &)> &sigh, const int &) {
+    entt::sink{sigh}.disconnect();
+}
+
+void atomic_increment(std::atomic<int> &counter, int value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
 TEST(SigH, Lifetime) {
     using signal = entt::sigh<void(void)>;
 
@@ -482,6 +495,339 @@ TEST(SigH, ConnectAndAutoDisconnect) {
     ASSERT_EQ(v, 1);
 }
 
+TEST(SigH, ConnectionVersion) {
+    sigh_listener listener;
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+
+    auto conn = sink.connect<&sigh_listener::g>(listener);
+    sink.disconnect<&sigh_listener::g>(listener);
+    sink.connect<&sigh_listener::g>(listener);
+
+    ASSERT_TRUE(conn);
+    ASSERT_EQ(sigh.size(), 1u);
+
+    conn.release();
+
+    ASSERT_FALSE(conn);
+    ASSERT_EQ(sigh.size(), 1u);
+
+    sink.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+}
+
+TEST(SigH, ConnectionOrder) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    sigh_listener listener;
+    int v = 0;
+
+    auto first = sink.connect<&sigh_listener::f>();
+    auto second = sink.connect<&sigh_listener::g>(listener);
+    auto third = sink.connect<&sigh_listener::h>(listener);
+
+    ASSERT_EQ(sigh.size(), 3u);
+
+    first.release();
+
+    ASSERT_EQ(sigh.size(), 2u);
+
+    third.release();
+    sigh.publish(v);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(v, 0);
+    ASSERT_TRUE(listener.val);
+
+    second.release();
+
+    ASSERT_TRUE(sigh.empty());
+}
+
+TEST(SigH, DisconnectDuringPublish) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    sigh_listener listener;
+    int v = 0;
+
+    sink.connect<&sigh_listener::f>();
+    sink.connect<&disconnect_all>(sigh);
+    sink.connect<&sigh_listener::g>(listener);
+
+    sigh.publish(v);
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(v, 0);
+    ASSERT_TRUE(listener.val);
+
+    sink.connect<&sigh_listener::f>();
+    sigh.publish(v);
+
+    ASSERT_EQ(sigh.size(), 1u);
+    ASSERT_EQ(v, 1);
+}
+
+TEST(SigH, OwningDelegate) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    auto token = std::make_shared<int>(2);
+    int v = 0;
+
+    sink.connect([token](int &value) { value += *token; });
+    auto conn = sink.connect([step = 3](int &value) { value += step; });
+
+    for(int next{}; next < 8; ++next) {
+        sink.connect<&sigh_listener::f>();
+        sink.connect([](int &value) { ++value; });
+    }
+
+    ASSERT_EQ(sigh.size(), 11u);
+    ASSERT_EQ(token.use_count(), 2);
+
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 14);
+
+    decltype(sigh) copy{sigh};
+
+    ASSERT_EQ(copy.size(), 1u);
+
+    v = 0;
+    copy.publish(v);
+
+    ASSERT_EQ(v, 1);
+
+    conn.release();
+    sink.disconnect<&sigh_listener::f>();
+
+    ASSERT_EQ(sigh.size(), 9u);
+
+    v = 0;
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 10);
+
+    sink.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(token.use_count(), 1);
+}
+
+TEST(SigH, OwningDelegateCopy) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    int v = 0;
+
+    sink.connect([step = 2](int &value) { value += step; });
+    sink.connect<&sigh_listener::f>();
+
+    decltype(sigh) copy{sigh};
+    entt::sink other{copy};
+
+    ASSERT_EQ(copy.size(), 1u);
+
+    for(int next{}; next < 4; ++next) {
+        copy = sigh;
+    }
+
+    other.connect([step = 3](int &value) { value += step; });
+    copy.publish(v);
+
+    ASSERT_EQ(copy.size(), 2u);
+    ASSERT_EQ(v, 4);
+
+    other.disconnect();
+
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(sigh.size(), 2u);
+}
+
+TEST(SigH, OwningDelegateConnectOnPublish) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    int v = 0;
+
+    sink.connect([&sink, step = 2](int &value) {
+        value += step;
+
+        for(int next{}; next < 64; ++next) {
+            sink.connect([](int &other) { ++other; });
+        }
+    });
+
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 2);
+    ASSERT_EQ(sigh.size(), 65u);
+
+    v = 0;
+    sink.disconnect();
+    sigh.publish(v);
+
+    ASSERT_TRUE(sigh.empty());
+    ASSERT_EQ(v, 0);
+}
+
+TEST(SigH, OwningDelegateDisconnectOnPublish) {
+    entt::sigh<void(int &)> sigh;
+    entt::sink sink{sigh};
+    entt::connection conn{};
+    int v = 0;
+
+    conn = sink.connect([&conn, step = 2](int &value) {
+        conn.release();
+        value += step;
+    });
+
+    sink.connect<&sigh_listener::f>();
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 3);
+    ASSERT_EQ(sigh.size(), 1u);
+
+    v = 0;
+    sigh.publish(v);
+
+    ASSERT_EQ(v, 1);
+}
+
+TEST(SigH, ConcurrentPublish) {
+    constexpr int count = 1000;
+    entt::sigh<void(int)> sigh;
+    std::atomic<int> counter{};
+    std::array<std::thread, 4u> publisher{};
+
+    entt::sink{sigh}.connect<&atomic_increment>(counter);
+
+    for(auto &&elem: publisher) {
+        elem = std::thread{[&signal = std::as_const(sigh)]() {
+            for(int next{}; next < count; ++next) {
+                signal.publish(1);
+            }
+        }};
+    }
+
+    for(auto &&elem: publisher) {
+        elem.join();
+    }
+
+    ASSERT_EQ(counter.load(), static_cast<int>(publisher.size()) * count);
+
+    entt::sink{sigh}.disconnect();
+
+    ASSERT_TRUE(sigh.empty());
+}
+
+TEST(SigH, PublishParallel) {
+    struct counter {
+        void incr(int value) {
+            cnt += value;
+        }
+
+        std::atomic<int> cnt{};
+    };
+
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    sigh_listener listener;
+    counter first{};
+    counter second{};
+    std::size_t tasks{};
+
+    sink.connect_parallel<&counter::incr>(first);
+    sink.connect<&sigh_listener::g>(listener);
+    sink.connect_parallel<&counter::incr>(second);
+
+    const auto executor = [&tasks](const std::size_t count, auto task) {
+        std::vector<std::thread> pool{};
+        tasks = count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            pool.emplace_back(task, pos);
+        }
+
+        for(auto &&elem: pool) {
+            elem.join();
+        }
+    };
+
+    sigh.publish_parallel(executor, 2);
+
+    ASSERT_EQ(tasks, 2u);
+    ASSERT_EQ(first.cnt, 2);
+    ASSERT_EQ(second.cnt, 2);
+    ASSERT_TRUE(listener.val);
+
+    sigh.publish(1);
+
+    ASSERT_EQ(first.cnt, 3);
+    ASSERT_EQ(second.cnt, 3);
+    ASSERT_FALSE(listener.val);
+
+    sink.disconnect(&first);
+    sigh.publish_parallel(executor, 1);
+
+    ASSERT_EQ(tasks, 1u);
+    ASSERT_EQ(first.cnt, 3);
+    ASSERT_EQ(second.cnt, 4);
+    ASSERT_TRUE(listener.val);
+}
+
+TEST(SigH, PublishParallelRange) {
+    struct recorder {
+        void push(int value) {
+            values.push_back(value);
+        }
+
+        std::vector<int> values{};
+    };
+
+    entt::sigh<void(int)> sigh;
+    entt::sink sink{sigh};
+    recorder serial{};
+    recorder first{};
+    recorder second{};
+    std::size_t invocations{};
+    std::size_t tasks{};
+
+    const std::array range{1, 2, 3};
+    const auto executor = [&invocations, &tasks](const std::size_t count, auto task) {
+        std::vector<std::thread> pool{};
+        ++invocations;
+        tasks = count;
+
+        for(std::size_t pos{}; pos < count; ++pos) {
+            pool.emplace_back(task, pos);
+        }
+
+        for(auto &&elem: pool) {
+            elem.join();
+        }
+    };
+
+    sigh.publish_parallel(executor, range.begin(), range.end());
+
+    ASSERT_EQ(invocations, 0u);
+
+    sink.connect<&recorder::push>(serial);
+    sink.connect_parallel<&recorder::push>(first);
+    sink.connect_parallel<&recorder::push>(second);
+
+    sigh.publish_parallel(executor, range.begin(), range.end());
+
+    ASSERT_EQ(invocations, 1u);
+    ASSERT_EQ(tasks, 2u);
+    ASSERT_EQ(serial.values, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(first.values, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(second.values, (std::vector<int>{1, 2, 3}));
+
+    sigh.publish_parallel(executor, range.begin(), range.begin());
+
+    ASSERT_EQ(invocations, 1u);
+    ASSERT_EQ(serial.values.size(), 3u);
+}
+
 TEST(SigH, CustomAllocator) {
     const std::allocator<void (*)(int)> allocator;
     entt::sigh<void(int), std::allocator<void (*)(int)>> sigh{allocator};